@@ -0,0 +1,164 @@
+#pragma once
+
+#include <bitset>
+
+#include "KeyScheme.hpp"
+#include "InputSampler.hpp"
+
+/**
+ * @class	ActionMap
+ *
+ * @brief	Turns the key changes of a tick into the state of the actions of the active KeyScheme.
+ *
+ * @detailed Each change is dispatched with a single lookup in the action table of the active scheme,
+ * 			 setting a bit in the set of held actions and in the set of actions that went down during the tick.
+ * 			 Switching schemes only swaps the table; the held actions are rebuilt from the held keys on the next update.
+ * 			 @code{.cpp}
+ * 			   actions.setScheme(keySchemes[keySchemeIndex]);
+ * 			   // every simulation tick
+ * 			   actions.update(keyboardState);
+ * 			   if (actions.isDown(PlayerAction::Jump)) {
+ * 			       doJump();
+ * 			   }
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ActionMap {
+public:
+	/** @brief	One bit per PlayerAction */
+	using ActionSet = std::bitset<static_cast<std::size_t>(PlayerAction::Count)>;
+
+private:
+	/** @brief	The active scheme, nullptr if no keys are bound */
+	const KeyScheme* scheme = nullptr;
+
+	/** @brief	Actions whose key is down */
+	ActionSet held;
+
+	/** @brief	Actions whose key went down during the tick */
+	ActionSet pressed;
+
+	/** @brief	True if held has to be rebuilt for a new scheme */
+	bool resync = true;
+
+public:
+
+	/**
+	 * @fn	void ActionMap::setScheme(const KeyScheme& scheme)
+	 *
+	 * @brief	Switches to the action table of scheme
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	scheme	The scheme, must outlive its use by the ActionMap.
+	 */
+
+	void setScheme(const KeyScheme& scheme) {
+		this->scheme = &scheme;
+		resync = true;
+	}
+
+	/**
+	 * @fn	void ActionMap::update(const KeyboardState& state)
+	 *
+	 * @brief	Applies the key changes of the current tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	state	The keyboard state of the current tick.
+	 */
+
+	void update(const KeyboardState& state) {
+		pressed.reset();
+
+		if (scheme == nullptr) {
+			held.reset();
+			return;
+		}
+
+		if (resync) {
+			held.reset();
+
+			for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+				const sf::Keyboard::Key key = static_cast<sf::Keyboard::Key>(i);
+				const PlayerAction action = scheme->getAction(key);
+
+				if (action != PlayerAction::None && state.isHeld(key)) {
+					held[static_cast<std::size_t>(action)] = true;
+				}
+			}
+
+			resync = false;
+		}
+
+		for (const InputEvent& event : state.getEvents()) {
+			const PlayerAction action = scheme->getAction(event.key);
+
+			if (action == PlayerAction::None) {
+				continue;
+			}
+
+			held[static_cast<std::size_t>(action)] = event.pressed;
+
+			if (event.pressed) {
+				pressed[static_cast<std::size_t>(action)] = true;
+			}
+		}
+	}
+
+	/**
+	 * @fn	bool ActionMap::isDown(PlayerAction action) const
+	 *
+	 * @brief	Query if the key of action is down, or went down at some point during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	action	The action.
+	 *
+	 * @return	True if down.
+	 */
+
+	bool isDown(PlayerAction action) const {
+		const std::size_t index = static_cast<std::size_t>(action);
+		return index < held.size() && (held[index] || pressed[index]);
+	}
+
+	/**
+	 * @fn	bool ActionMap::wasPressed(PlayerAction action) const
+	 *
+	 * @brief	Query if the key of action went down during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	action	The action.
+	 *
+	 * @return	True if pressed.
+	 */
+
+	bool wasPressed(PlayerAction action) const {
+		const std::size_t index = static_cast<std::size_t>(action);
+		return index < pressed.size() && pressed[index];
+	}
+
+	/**
+	 * @fn	const ActionSet& ActionMap::getHeld() const
+	 *
+	 * @brief	Gets the held actions
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The held actions, indexed by PlayerAction.
+	 */
+
+	const ActionSet& getHeld() const {
+		return held;
+	}
+};
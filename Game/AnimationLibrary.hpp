@@ -0,0 +1,169 @@
+#pragma once
+
+#include <istream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <SFML/Graphics.hpp>
+
+#include "BaseFactory.hpp"
+#include "KeyValuePair.hpp"
+#include "MapItemProperties.hpp"
+#include "StreamManipulators.hpp"
+
+/**
+ * @struct	AnimationFrame
+ *
+ * @brief	A single frame of an AnimationClip.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct AnimationFrame {
+	/** @brief	Identifier of the texture in the AssetManager */
+	std::string textureId;
+
+	/** @brief	Region of the texture, only used if wholeTexture is false */
+	sf::IntRect rect;
+
+	/** @brief	True if the frame shows the whole texture */
+	bool wholeTexture = true;
+};
+
+/**
+ * @struct	AnimationClip
+ *
+ * @brief	A list of frames played at a fixed frame time.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct AnimationClip {
+	/** @brief	The frames */
+	std::vector<AnimationFrame> frames;
+
+	/** @brief	Duration of a single frame in seconds */
+	float frameTime = 0.05f;
+
+	/** @brief	True to start over after the last frame, false to hold the last frame */
+	bool loop = true;
+};
+
+/**
+ * @class	AnimationLibrary
+ *
+ * @brief	Named animation clips read from a data file.
+ *
+ * @detailed The data file uses the same format as the map files. Every clip lists its frames in order,
+ * 			 either as whole textures or as regions of an atlas texture:
+ * 			 clip {
+ * 				Id = "fimmy-walk-right-rightLeg"
+ * 				FrameTime = 0.05
+ * 				Loop = true
+ * 				Frame = "fimmyRightLeg"
+ * 				Frame = "fimmyRightLeg2"
+ * 			 }
+ * 			 clip {
+ * 				Id = "bat-fly"
+ * 				Atlas = "bat"
+ * 				FrameRect = Rect(0, 0, 32, 32)
+ * 				FrameRect = Rect(32, 0, 32, 32)
+ * 			 }
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class AnimationLibrary : public BaseFactory<void, std::string, AnimationLibrary&, const MapItemProperties&> {
+	/** @brief	The clips by identifier, std::map keeps clip addresses stable while clips are added */
+	std::map<std::string, AnimationClip> clips;
+
+public:
+	/** @brief	Retrieve KeyValuePair::Type into local scope */
+	using Type = KeyValuePair::Type;
+
+	/** @brief	Retrieve KeyValuePair::Value into local scope */
+	using Value = KeyValuePair::Value;
+
+	/**
+	 * @fn	AnimationLibrary::AnimationLibrary()
+	 *
+	 * @brief	Default constructor, registers the clip loader
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	AnimationLibrary() {
+		registerCreateMethod("clip", [](AnimationLibrary& library, const MapItemProperties& properties) {
+			std::string id;
+			std::string atlas;
+			AnimationClip clip;
+
+			properties.read({
+				{ "Id", Type::String, [&](Value value) { id = *value.stringValue; } },
+				{ "FrameTime", Type::Float, [&](Value value) { clip.frameTime = value.floatValue; } },
+				{ "Loop", Type::Bool, [&](Value value) { clip.loop = value.b; } },
+				{ "Atlas", Type::String, [&](Value value) { atlas = *value.stringValue; } },
+				{ "Frame", Type::String, [&](Value value) { clip.frames.push_back({ *value.stringValue, sf::IntRect(), true }); } },
+				{ "FrameRect", Type::Rect, [&](Value value) { clip.frames.push_back({ atlas, sf::IntRect(*value.rectValue), false }); } }
+			});
+
+			if (id.size() > 0 && clip.frames.size() > 0 && clip.frameTime > 0) {
+				library.clips[id] = std::move(clip);
+			}
+		});
+	}
+
+	/**
+	 * @fn	void AnimationLibrary::load(std::istream& input)
+	 *
+	 * @brief	Reads all clips from input, clips with an existing identifier are replaced
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	input	Input stream to read from.
+	 */
+
+	void load(std::istream& input) {
+		input >> std::ws;
+
+		while (input && !input.eof()) {
+			std::string name;
+			input >> exceptions >> name;
+
+			MapItemProperties properties;
+			input >> exceptions >> properties;
+
+			create(name, *this, properties);
+			input >> std::ws;
+		}
+	}
+
+	/**
+	 * @fn	const AnimationClip* AnimationLibrary::find(const std::string& id) const
+	 *
+	 * @brief	Searches for a clip
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The clip identifier.
+	 *
+	 * @return	The clip, nullptr if no clip with id exists.
+	 */
+
+	const AnimationClip* find(const std::string& id) const {
+		auto it = clips.find(id);
+
+		if (it == clips.end()) {
+			return nullptr;
+		}
+
+		return &it->second;
+	}
+};
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+
+#include "AnimationLibrary.hpp"
+#include "AssetManager.hpp"
+
+/**
+ * @class	AnimationSystem
+ *
+ * @brief	Plays AnimationClips on shapes or other frame targets, advancing all of them in a single pass.
+ *
+ * @detailed Playback state is kept in parallel arrays indexed by the animation identifier returned by AnimationSystem::add().
+ * 			 AnimationSystem::update() advances every playing animation by the elapsed simulation time and only calls
+ * 			 the target of an animation when its frame actually changes, so an animation that has not changed frame costs
+ * 			 a few arithmetic operations per update.
+ * 			 @code{.cpp}
+ * 			   std::size_t walk = animations.add(enemy);
+ * 			   animations.play(walk, *library.find("bat-fly"));
+ * 			   // every simulation tick
+ * 			   animations.update(elapsedTime);
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class AnimationSystem {
+public:
+	/** @brief	Target that shows a frame */
+	using FrameTarget = std::function<void(const AnimationFrame&)>;
+
+private:
+	/** @brief	The animation targets, empty for removed animations */
+	std::vector<FrameTarget> targets;
+
+	/** @brief	The playing clips, nullptr if stopped */
+	std::vector<const AnimationClip*> clips;
+
+	/** @brief	Playback position in seconds */
+	std::vector<float> times;
+
+	/** @brief	Playback speed factors */
+	std::vector<float> speeds;
+
+	/** @brief	The frame currently shown, -1 if no frame has been applied yet */
+	std::vector<int32_t> frames;
+
+	/** @brief	The frame to show after the current update */
+	std::vector<int32_t> nextFrames;
+
+	/** @brief	Removed animation identifiers that can be reused */
+	std::vector<std::size_t> freeIds;
+
+	/**
+	 * @fn	void AnimationSystem::advance(std::size_t id, const float elapsedTime)
+	 *
+	 * @brief	Advances the playback position of an animation and computes the frame it has to show.
+	 * 			Only touches the state of id, so animations can be advanced on different threads.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id		   	The animation identifier.
+	 * @param	elapsedTime	The elapsed simulation time in seconds.
+	 */
+
+	void advance(std::size_t id, const float elapsedTime) {
+		const AnimationClip* clip = clips[id];
+
+		if (clip == nullptr) {
+			nextFrames[id] = frames[id];
+			return;
+		}
+
+		times[id] += elapsedTime * speeds[id];
+
+		const int32_t frameCount = static_cast<int32_t>(clip->frames.size());
+		int32_t frame = static_cast<int32_t>(times[id] / clip->frameTime);
+
+		if (clip->loop) {
+			frame %= frameCount;
+			times[id] -= static_cast<int32_t>(times[id] / (clip->frameTime * frameCount)) * clip->frameTime * frameCount;
+		}
+		else if (frame >= frameCount) {
+			frame = frameCount - 1;
+		}
+
+		nextFrames[id] = frame;
+	}
+
+	/**
+	 * @fn	void AnimationSystem::applyFrames()
+	 *
+	 * @brief	Calls the targets of the animations whose frame changed during the update, in identifier order
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void applyFrames() {
+		for (std::size_t id = 0; id < targets.size(); id++) {
+			if (clips[id] != nullptr && nextFrames[id] != frames[id]) {
+				frames[id] = nextFrames[id];
+				targets[id](clips[id]->frames[frames[id]]);
+			}
+		}
+	}
+
+	/**
+	 * @fn	static void AnimationSystem::apply(sf::Shape& target, const AnimationFrame& frame)
+	 *
+	 * @brief	Shows frame on target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The shape.
+	 * @param 		  	frame 	The frame.
+	 */
+
+	static void apply(sf::Shape& target, const AnimationFrame& frame) {
+		const sf::Texture& texture = AssetManager::instance()->getTexture(frame.textureId);
+
+		target.setTexture(&texture);
+
+		if (frame.wholeTexture) {
+			target.setTextureRect(sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+		}
+		else {
+			target.setTextureRect(frame.rect);
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	std::size_t AnimationSystem::add(sf::Shape& target)
+	 *
+	 * @brief	Adds an animation that sets the texture of target, target must outlive the animation or be removed first
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The shape to animate.
+	 *
+	 * @return	The animation identifier.
+	 */
+
+	std::size_t add(sf::Shape& target) {
+		return add([&target](const AnimationFrame& frame) {
+			apply(target, frame);
+		});
+	}
+
+	/**
+	 * @fn	std::size_t AnimationSystem::add(FrameTarget target)
+	 *
+	 * @brief	Adds an animation that calls target whenever the shown frame changes
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	target	The frame target.
+	 *
+	 * @return	The animation identifier.
+	 */
+
+	std::size_t add(FrameTarget target) {
+		if (freeIds.size() > 0) {
+			std::size_t id = freeIds.back();
+			freeIds.pop_back();
+
+			targets[id] = std::move(target);
+			clips[id] = nullptr;
+			times[id] = 0;
+			speeds[id] = 1;
+			frames[id] = -1;
+			nextFrames[id] = -1;
+
+			return id;
+		}
+
+		targets.push_back(std::move(target));
+		clips.push_back(nullptr);
+		times.push_back(0);
+		speeds.push_back(1);
+		frames.push_back(-1);
+		nextFrames.push_back(-1);
+
+		return targets.size() - 1;
+	}
+
+	/**
+	 * @fn	void AnimationSystem::remove(std::size_t id)
+	 *
+	 * @brief	Removes an animation, the target keeps its current frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The animation identifier.
+	 */
+
+	void remove(std::size_t id) {
+		targets[id] = nullptr;
+		clips[id] = nullptr;
+		freeIds.push_back(id);
+	}
+
+	/**
+	 * @fn	void AnimationSystem::play(std::size_t id, const AnimationClip& clip)
+	 *
+	 * @brief	Plays clip from the start, unless clip is already playing
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id  	The animation identifier.
+	 * @param	clip	The clip, must outlive its playback.
+	 */
+
+	void play(std::size_t id, const AnimationClip& clip) {
+		if (clips[id] != &clip) {
+			clips[id] = &clip;
+			times[id] = 0;
+			frames[id] = -1;
+		}
+	}
+
+	/**
+	 * @fn	void AnimationSystem::stop(std::size_t id)
+	 *
+	 * @brief	Stops playback, the target keeps its current frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The animation identifier.
+	 */
+
+	void stop(std::size_t id) {
+		clips[id] = nullptr;
+	}
+
+	/**
+	 * @fn	void AnimationSystem::setSpeed(std::size_t id, float speed)
+	 *
+	 * @brief	Sets the playback speed factor, 2 plays twice as fast
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id   	The animation identifier.
+	 * @param	speed	The speed factor.
+	 */
+
+	void setSpeed(std::size_t id, float speed) {
+		speeds[id] = speed;
+	}
+
+	/**
+	 * @fn	void AnimationSystem::update(const float elapsedTime)
+	 *
+	 * @brief	Advances all playing animations by elapsedTime seconds of simulation time
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	elapsedTime	The elapsed simulation time in seconds.
+	 */
+
+	void update(const float elapsedTime) {
+		for (std::size_t id = 0; id < targets.size(); id++) {
+			advance(id, elapsedTime);
+		}
+
+		applyFrames();
+	}
+};
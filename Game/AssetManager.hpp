@@ -5,6 +5,9 @@
 #include <exception>
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <iostream>
+#include <mutex>
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 
@@ -191,6 +194,14 @@ public:
  * @class	AssetManager
  *
  * @brief	Manager for assets.
+ * 			
+ * @detailed Every loaded asset carries a reference count. Owners take references using AssetManager::acquire(const std::string&)
+ * 			 (usually through an AssetReference) and give them back using AssetManager::release(const std::string&).
+ * 			 Unreferenced textures and sound buffers stay resident until AssetManager::collect() trims the resident set
+ * 			 back under the memory budget, evicting the least recently released assets first.
+ * 			 The file location of an evicted asset is remembered, so acquiring it again reloads it from disk.
+ * 			 Loading, getting and releasing assets may happen from several threads. The maps returned by
+ * 			 AssetManager::getTextures(), AssetManager::getSounds() and AssetManager::getFonts() are only safe to use on the main thread.
  *
  * @author	Wiebe
  * @date	24-1-2018
@@ -199,6 +210,31 @@ public:
 class AssetManager {
 private:
 
+	/**
+	 * @struct	Residency
+	 *
+	 * @brief	Bookkeeping of a single asset used for reference counting and eviction.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Residency {
+		/** @brief	Amount of AssetReferences currently holding the asset */
+		unsigned int references = 0;
+
+		/** @brief	Estimated memory footprint of the asset in bytes, 0 for assets that are never evicted */
+		std::size_t bytes = 0;
+
+		/** @brief	Release tick of the last dropped reference, used to evict the least recently used asset first */
+		uint64_t lastReleased = 0;
+
+		/** @brief	Texture repeat flag, restored when an evicted texture is reloaded */
+		bool repeated = false;
+
+		/** @brief	Texture smooth flag, restored when an evicted texture is reloaded */
+		bool smooth = false;
+	};
 
 	/** @brief	The textures */
 	std::map<std::string, sf::Texture> textures;
@@ -212,17 +248,68 @@ private:
 	std::map<std::string, std::string> fileLocations;
 
 	/**
-	 * @property	std::vector < std::unique_ptr < sf::SoundBuffer> > soundBuffers
+	 * @property	std::map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers
 	 *
-	 * @brief	Gets the sound buffers
+	 * @brief	Gets the sound buffers, keyed by the id of the sound playing them
 	 *
 	 * @return	The sound buffers.
 	 */
 
-	std::vector < std::unique_ptr < sf::SoundBuffer> > soundBuffers;
+	std::map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers;
+
+	/** @brief	Reference counts and sizes of all loaded assets */
+	std::map<std::string, Residency> residency;
+
+	/** @brief	Upper bound for the resident texture and sound buffer memory in bytes, see AssetManager::collect() */
+	std::size_t memoryBudget = 64 * 1024 * 1024;
+
+	/** @brief	Total resident texture and sound buffer memory in bytes */
+	std::size_t residentBytes = 0;
+
+	/** @brief	Monotonic counter stamped on assets when their last reference is released */
+	uint64_t releaseTick = 0;
+
+	/** @brief	Guards the assets and their bookkeeping, states may be constructed on a worker thread, see Statemachine::prewarmState() */
+	mutable std::recursive_mutex mutex;
 
 	static AssetManager* sInstance;
 
+	/**
+	 * @fn	void AssetManager::makeResident(const std::string& id, std::size_t bytes)
+	 *
+	 * @brief	Registers a freshly loaded asset in the residency bookkeeping
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id   	The asset identifier.
+	 * @param	bytes	The estimated memory footprint.
+	 */
+
+	void makeResident(const std::string& id, std::size_t bytes) {
+		Residency& entry = residency[id];
+
+		entry.bytes = bytes;
+		residentBytes += bytes;
+	}
+
+	/**
+	 * @fn	bool AssetManager::isLoaded(const std::string& id) const
+	 *
+	 * @brief	Query if an asset is currently resident
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The asset identifier.
+	 *
+	 * @return	True if the asset is loaded, false if it is evicted or unknown.
+	 */
+
+	bool isLoaded(const std::string& id) const {
+		return textures.find(id) != textures.end() || fonts.find(id) != fonts.end() || sounds.find(id) != sounds.end();
+	}
+
 public:
 
 	/**
@@ -260,9 +347,15 @@ public:
 		textures = std::move(rhs.textures);
 		fonts = std::move(rhs.fonts);
 		sounds = std::move(rhs.sounds);
-
-		for (const auto& e : rhs.soundBuffers)
-			soundBuffers.push_back(std::make_unique<sf::SoundBuffer>(*e));
+		fileLocations = rhs.fileLocations;
+		residency = rhs.residency;
+		memoryBudget = rhs.memoryBudget;
+		residentBytes = rhs.residentBytes;
+
+		for (const auto& e : rhs.soundBuffers) {
+			soundBuffers[e.first] = std::make_unique<sf::SoundBuffer>(*e.second);
+			sounds[e.first].setBuffer(*soundBuffers[e.first]);
+		}
 
 		return *this;
 	}
@@ -286,6 +379,8 @@ public:
 	 */
 
 	void load(const std::string id, const std::string filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		std::string::size_type idx;
 
 		idx = filename.rfind('.');
@@ -328,17 +423,65 @@ public:
 	 */
 
 	void loadTexture(const std::string id, const std::string filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		if (textures.find(id) != textures.end()) {
 			return;
 		}
 
-		sf::Texture _texture;
+		sf::Texture& _texture = textures[id];
 
 		if (_texture.loadFromFile(filename)) {
 			fileLocations[id] = filename;
-			textures[id] = _texture;
+
+			// Restore the sampling flags of a texture that has been evicted before.
+			Residency& entry = residency[id];
+			_texture.setRepeated(entry.repeated);
+			_texture.setSmooth(entry.smooth);
+
+			makeResident(id, static_cast<std::size_t>(_texture.getSize().x) * _texture.getSize().y * 4);
+		}
+		else {
+			textures.erase(id);
+			throw AssetNotFoundByPathException(filename, "texture");
+		}
+	}
+
+	/**
+	 * @fn	void AssetManager::loadTexture(const std::string& id, const sf::Image& image, const std::string& filename)
+	 *
+	 * @brief	Loads a texture from an image that has already been decoded, for instance by an ImagePrefetcher
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotFoundByPathException	Thrown when the image could not be uploaded.
+	 *
+	 * @param	id			The identifier.
+	 * @param	image		The decoded image.
+	 * @param	filename	Filename the image was decoded from, used to reload the texture after eviction.
+	 */
+
+	void loadTexture(const std::string& id, const sf::Image& image, const std::string& filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		if (textures.find(id) != textures.end()) {
+			return;
+		}
+
+		sf::Texture& _texture = textures[id];
+
+		if (_texture.loadFromImage(image)) {
+			fileLocations[id] = filename;
+
+			Residency& entry = residency[id];
+			_texture.setRepeated(entry.repeated);
+			_texture.setSmooth(entry.smooth);
+
+			makeResident(id, static_cast<std::size_t>(_texture.getSize().x) * _texture.getSize().y * 4);
 		}
 		else {
+			textures.erase(id);
 			throw AssetNotFoundByPathException(filename, "texture");
 		}
 	}
@@ -359,6 +502,8 @@ public:
 	 */
 
 	sf::Texture& getTexture(const std::string id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		try {
 			return textures.at(id);
 		}
@@ -383,6 +528,8 @@ public:
 	 */
 
 	void loadFont(const std::string id, const std::string filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		if (fonts.find(id) != fonts.end()) {
 			return;
 		}
@@ -392,6 +539,9 @@ public:
 		if (_font.loadFromFile(filename)) {
 			fileLocations[id] = filename;
 			fonts[id] = _font;
+
+			// Glyph pages are owned by sf::Font and cannot be measured up front, fonts are never evicted.
+			makeResident(id, 0);
 		}
 		else {
 			throw AssetNotFoundByPathException(filename, "font");
@@ -414,6 +564,8 @@ public:
 	 */
 
 	sf::Font& getFont(const std::string id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		try {
 			return fonts.at(id);
 		}
@@ -437,19 +589,24 @@ public:
 	 */
 
 	void loadSound(const std::string id, const std::string filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		if (sounds.find(id) != sounds.end()) {
 			return;
 		}
 
-		soundBuffers.push_back(std::move(std::make_unique<sf::SoundBuffer>()));
+		std::unique_ptr<sf::SoundBuffer> buffer = std::make_unique<sf::SoundBuffer>();
 
-		if (soundBuffers.back()->loadFromFile(filename)) {
+		if (buffer->loadFromFile(filename)) {
 			sf::Sound _sound;
 			
-			_sound.setBuffer(*soundBuffers.back());
+			_sound.setBuffer(*buffer);
 
 			fileLocations[id] = filename;
 			sounds[id] = _sound;
+
+			makeResident(id, static_cast<std::size_t>(buffer->getSampleCount()) * sizeof(sf::Int16));
+			soundBuffers[id] = std::move(buffer);
 		}
 		else {
 			throw AssetNotFoundByPathException(filename, "sound");
@@ -472,6 +629,8 @@ public:
 	 */
 
 	sf::Sound& getSound(const std::string id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		try {
 			return sounds.at(id);
 		}
@@ -480,6 +639,215 @@ public:
 		}
 	}
 
+	/**
+	 * @fn	void AssetManager::acquire(const std::string& id)
+	 *
+	 * @brief	Takes a reference to an asset, reloading it from its known file location if it has been evicted.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotLoadedException	Thrown when the asset was never loaded, so its file location is unknown.
+	 *
+	 * @param	id	The asset identifier.
+	 */
+
+	void acquire(const std::string& id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		if (!isLoaded(id)) {
+			auto it = fileLocations.find(id);
+
+			if (it == fileLocations.end()) {
+				throw AssetNotLoadedException(id);
+			}
+
+			load(id, it->second);
+		}
+
+		residency[id].references++;
+	}
+
+	/**
+	 * @fn	void AssetManager::acquire(const std::string& id, const std::string& filename)
+	 *
+	 * @brief	Takes a reference to an asset, loading it from filename when it is not resident.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id			The asset identifier.
+	 * @param	filename	Filename of the asset.
+	 */
+
+	void acquire(const std::string& id, const std::string& filename) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		if (!isLoaded(id)) {
+			load(id, filename);
+		}
+
+		residency[id].references++;
+	}
+
+	/**
+	 * @fn	void AssetManager::release(const std::string& id)
+	 *
+	 * @brief	Gives back a reference taken with AssetManager::acquire(const std::string&).
+	 * 			The asset stays resident until AssetManager::collect() evicts it.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The asset identifier.
+	 */
+
+	void release(const std::string& id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		auto it = residency.find(id);
+
+		if (it != residency.end() && it->second.references > 0) {
+			if (--it->second.references == 0) {
+				it->second.lastReleased = ++releaseTick;
+			}
+		}
+	}
+
+	/**
+	 * @fn	void AssetManager::unload(const std::string& id)
+	 *
+	 * @brief	Evicts an unreferenced texture or sound buffer. Referenced assets and fonts are left untouched.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	The asset identifier.
+	 */
+
+	void unload(const std::string& id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		auto it = residency.find(id);
+
+		if (it == residency.end() || it->second.references > 0 || it->second.bytes == 0) {
+			return;
+		}
+
+		auto texture = textures.find(id);
+
+		if (texture != textures.end()) {
+			it->second.repeated = texture->second.isRepeated();
+			it->second.smooth = texture->second.isSmooth();
+			textures.erase(texture);
+		}
+
+		// The sf::Sound has to go before the buffer it is playing from.
+		sounds.erase(id);
+		soundBuffers.erase(id);
+
+		residentBytes -= it->second.bytes;
+		it->second.bytes = 0;
+	}
+
+	/**
+	 * @fn	void AssetManager::collect()
+	 *
+	 * @brief	Evicts unreferenced textures and sound buffers, least recently released first, until the resident memory fits the memory budget.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void collect() {
+		collect(memoryBudget);
+	}
+
+	/**
+	 * @fn	void AssetManager::collect(std::size_t budget)
+	 *
+	 * @brief	Evicts unreferenced textures and sound buffers, least recently released first, until the resident memory fits budget.
+	 * 			Use a budget of 0 to evict every unreferenced asset.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	budget	The budget in bytes.
+	 */
+
+	void collect(std::size_t budget) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		std::vector<std::pair<uint64_t, std::string>> candidates;
+
+		for (const auto& entry : residency) {
+			if (entry.second.references == 0 && entry.second.bytes > 0) {
+				candidates.emplace_back(entry.second.lastReleased, entry.first);
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+
+		for (const auto& candidate : candidates) {
+			if (residentBytes <= budget) {
+				break;
+			}
+
+			unload(candidate.second);
+		}
+	}
+
+	/**
+	 * @fn	void AssetManager::setMemoryBudget(std::size_t bytes)
+	 *
+	 * @brief	Sets the upper bound for resident texture and sound buffer memory used by AssetManager::collect()
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	bytes	The budget in bytes.
+	 */
+
+	void setMemoryBudget(std::size_t bytes) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		memoryBudget = bytes;
+	}
+
+	/**
+	 * @fn	std::size_t AssetManager::getMemoryBudget() const
+	 *
+	 * @brief	Gets the memory budget
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The budget in bytes.
+	 */
+
+	std::size_t getMemoryBudget() const {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		return memoryBudget;
+	}
+
+	/**
+	 * @fn	std::size_t AssetManager::getResidentBytes() const
+	 *
+	 * @brief	Gets the estimated memory held by resident textures and sound buffers
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The resident memory in bytes.
+	 */
+
+	std::size_t getResidentBytes() const {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		return residentBytes;
+	}
+
 	/**
 	 * @fn	std::map<std::string, sf::Texture>& AssetManager::getTextures()
 	 *
@@ -539,6 +907,8 @@ public:
 	 */
 
 	std::string resolveTextureID(const sf::Texture &t) const {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		for (const auto &mapT : textures) {
 			if (&mapT.second == &t) {
 				return mapT.first;
@@ -549,6 +919,8 @@ public:
 	}
 
 	std::string getFilename(std::string id) {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		try {
 			return fileLocations.at(id);
 		}
@@ -567,11 +939,16 @@ public:
 	 */
 
 	void clear() {
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
 		textures.clear();
 		fonts.clear();
 		sounds.clear();
+		soundBuffers.clear();
+		residency.clear();
+		residentBytes = 0;
 	}
 };
 
 /** @brief	The asset manager singleton instance */
-AssetManager* AssetManager::sInstance = nullptr;
\ No newline at end of file
+AssetManager* AssetManager::sInstance = nullptr;
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <string>
+
+#include "AssetManager.hpp"
+
+/**
+ * @class	AssetReference
+ *
+ * @brief	Reference counted handle to an asset in the AssetManager.
+ *
+ * @detailed The asset is kept resident for as long as at least one AssetReference to it exists.
+ * 			 Copying a reference takes another reference, destroying it gives the reference back.
+ * 			 @code{.cpp}
+ * 			   AssetReference jump("jump", "jump.wav"); // loads jump.wav if it is not resident
+ * 			   AssetManager::instance()->getSound("jump").play();
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class AssetReference {
+	/** @brief	The referenced asset identifier, empty for a null reference */
+	std::string id;
+
+public:
+
+	/**
+	 * @fn	AssetReference::AssetReference()
+	 *
+	 * @brief	Constructs a null reference
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	AssetReference() { }
+
+	/**
+	 * @fn	AssetReference::AssetReference(const std::string& id)
+	 *
+	 * @brief	Takes a reference to an asset that has been loaded before.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotLoadedException	Thrown when the asset was never loaded.
+	 *
+	 * @param	id	The asset identifier.
+	 */
+
+	AssetReference(const std::string& id) : id(id) {
+		AssetManager::instance()->acquire(id);
+	}
+
+	/**
+	 * @fn	AssetReference::AssetReference(const std::string& id, const std::string& filename)
+	 *
+	 * @brief	Takes a reference to an asset, loading it from filename if needed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id			The asset identifier.
+	 * @param	filename	Filename of the asset.
+	 */
+
+	AssetReference(const std::string& id, const std::string& filename) : id(id) {
+		AssetManager::instance()->acquire(id, filename);
+	}
+
+	/**
+	 * @fn	AssetReference::AssetReference(const AssetReference& rhs)
+	 *
+	 * @brief	Copy constructor, takes another reference to the same asset
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The right hand side.
+	 */
+
+	AssetReference(const AssetReference& rhs) : id(rhs.id) {
+		if (id.size() > 0) {
+			AssetManager::instance()->acquire(id);
+		}
+	}
+
+	/**
+	 * @fn	AssetReference::AssetReference(AssetReference&& rhs)
+	 *
+	 * @brief	Move constructor, takes over the reference of rhs
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The right hand side.
+	 */
+
+	AssetReference(AssetReference&& rhs) noexcept : id(std::move(rhs.id)) {
+		rhs.id.clear();
+	}
+
+	/**
+	 * @fn	AssetReference& AssetReference::operator= (AssetReference rhs)
+	 *
+	 * @brief	Assignment operator, gives back the current reference and takes over rhs
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The right hand side.
+	 *
+	 * @return	A reference to this object.
+	 */
+
+	AssetReference& operator= (AssetReference rhs) {
+		std::swap(id, rhs.id);
+
+		return *this;
+	}
+
+	/**
+	 * @fn	AssetReference::~AssetReference()
+	 *
+	 * @brief	Destructor, gives back the reference
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~AssetReference() {
+		if (id.size() > 0) {
+			AssetManager::instance()->release(id);
+		}
+	}
+
+	/**
+	 * @fn	const std::string& AssetReference::getId() const
+	 *
+	 * @brief	Gets the referenced asset identifier
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The identifier, empty for a null reference.
+	 */
+
+	const std::string& getId() const {
+		return id;
+	}
+};
@@ -113,6 +113,58 @@ public:
 		velocity += force;
 	}
 
+	/**
+	 * @struct	Snapshot
+	 *
+	 * @brief	The state of a body that changes while simulating, restored with Body::restore().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Snapshot {
+		/** @brief	The position */
+		sf::Vector2f position;
+		/** @brief	The velocity */
+		sf::Vector2f velocity;
+		/** @brief	The size */
+		sf::Vector2f size;
+	};
+
+	static_assert(sizeof(Snapshot) == 6 * sizeof(float), "Body::Snapshot must not contain padding bytes");
+
+	/**
+	 * @fn	Snapshot Body::getSnapshot() const
+	 *
+	 * @brief	Captures the position, velocity and size of the body
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The snapshot.
+	 */
+
+	Snapshot getSnapshot() const {
+		return { getPosition(), getVelocity(), getSize() };
+	}
+
+	/**
+	 * @fn	void Body::restore(const Snapshot& snapshot)
+	 *
+	 * @brief	Restores the position, velocity and size captured by Body::getSnapshot()
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	snapshot	The snapshot.
+	 */
+
+	void restore(const Snapshot& snapshot) {
+		setSize(snapshot.size);
+		setPosition(snapshot.position);
+		setVelocity(snapshot.velocity);
+	}
+
 	/**
 	 * @fn	std::ofstream& Body::writeToFile(std::ofstream& of) override
 	 *
@@ -1,8 +1,11 @@
 #pragma  once
 
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include "Body.hpp"
 #include "Label.hpp"
+#include "Widget.hpp"
+#include "RenderList.hpp"
 #include "EventSource.hpp"
 #include "EventConnection.hpp"
 #include "Mouse.hpp"
@@ -16,7 +19,7 @@
  * @date	25-1-2018
  */
 
-class Button : public sf::Drawable {
+class Button : public Widget {
 private:
 
     /** @brief	The button background */
@@ -55,21 +58,21 @@ private:
 
 	void bindEvents() {
 		mouseLeftButtonDownConn = game.mouse.mouseLeftButtonDown.connect([this](const sf::Vector2i mousePos) {
-			if (background.getGlobalBounds().contains(game.window->mapPixelToCoords(mousePos))) {
+			if (background.getGlobalBounds().contains(game.renderList->mapPixelToCoords(mousePos))) {
 				buttonPressed.fire();
 				isPressed = true;
 			}
 		});
 
 		mouseLeftButtonUpConn = game.mouse.mouseLeftButtonUp.connect([this](const sf::Vector2i mousePos) {
-			if (background.getGlobalBounds().contains(game.window->mapPixelToCoords(mousePos)) && isPressed) {
+			if (background.getGlobalBounds().contains(game.renderList->mapPixelToCoords(mousePos)) && isPressed) {
 				buttonReleased.fire();
 				isPressed = false;
 			}
 		});
 
 		mouseMovedConn = game.mouse.mouseMoved.connect([this](const sf::Vector2i mousePos) {
-			if (background.getGlobalBounds().contains(game.window->mapPixelToCoords(mousePos))) {
+			if (background.getGlobalBounds().contains(game.renderList->mapPixelToCoords(mousePos))) {
 				if (mouseInside == false) {
 					mouseInside = true;
 					mouseEnter.fire();
@@ -147,6 +150,7 @@ public:
 	 * @param size Vector with the size of the background.
 	 */
 	void setSize(sf::Vector2f size) {
+		markDirty();
 		background.setSize(size);
 	}
 	/**
@@ -178,7 +182,10 @@ public:
 	 * @param color The color for the button.
 	 */
 	void setBackgroundColor(sf::Color color) {
-		background.setFillColor(color);
+		if (background.getFillColor() != color) {
+			markDirty();
+			background.setFillColor(color);
+		}
 	}
 
 	/**
@@ -194,8 +201,11 @@ public:
 	 * @param position The position fo the button.
 	 */
 	void setPosition(sf::Vector2f position) {
-		background.setPosition(position);
-		textLabel.setPosition(position);
+		if (background.getPosition() != position) {
+			markDirty();
+			background.setPosition(position);
+			textLabel.setPosition(position);
+		}
 	}
 
 	/**
@@ -219,8 +229,46 @@ public:
 	 * @param window The display the button will be displayed on.
 	 */
     void draw(sf::RenderTarget& window, sf::RenderStates renderStates) const {
-		window.draw(background);
-		window.draw(textLabel);
+		window.draw(background, renderStates);
+		window.draw(textLabel, renderStates);
     }
+
+	/**
+	 * @brief Record the button into a render list.
+	 * @param renderList The render list the button will be recorded into.
+	 */
+    void draw(RenderList& renderList, sf::RenderStates renderStates) const override {
+		renderList.draw(background, renderStates);
+		renderList.draw(textLabel, renderStates);
+    }
+
+	/**
+	 * @brief Query if the background or the text changed since the button was last composed.
+	 * @return True if dirty.
+	 */
+	bool isDirty() const override {
+		return Widget::isDirty() || textLabel.isDirty();
+	}
+
+	/**
+	 * @brief Marks the background and the text as composed.
+	 */
+	void markClean() override {
+		Widget::markClean();
+		textLabel.markClean();
+	}
+
+	/**
+	 * @brief The area the button draws to.
+	 * @return The union of the bounds of the background and the text.
+	 */
+	sf::FloatRect getGlobalBounds() const override {
+		const sf::FloatRect a = background.getGlobalBounds();
+		const sf::FloatRect b = textLabel.getGlobalBounds();
+		const float left = std::min(a.left, b.left);
+		const float top = std::min(a.top, b.top);
+
+		return sf::FloatRect(left, top, std::max(a.left + a.width, b.left + b.width) - left, std::max(a.top + a.height, b.top + b.height) - top);
+	}
 };
 
@@ -0,0 +1,374 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <list>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cmath>
+#include <cstdint>
+
+#include "RenderList.hpp"
+
+/**
+ * @class	ChunkCache
+ *
+ * @brief	LRU cache of pre-rendered world regions.
+ *
+ * @detailed The world is divided in square chunks. A chunk overlapping the view is rasterized once into
+ * 			 an sf::RenderTexture at one texel per world unit and drawn as a single textured quad afterwards,
+ * 			 so the cost of drawing a region does not depend on the amount of geometry in it.
+ * 			 Chunks are kept until they are invalidated or until the cache exceeds its byte budget,
+ * 			 in which case the least recently drawn chunks outside the view are evicted first.
+ * 			 Frames that are rendered on a RenderThread may still sample a dropped chunk, so the texture of a dropped chunk
+ * 			 is only reused after ChunkCache::retireFrames more frames have been prepared.
+ * 			 The budget is a hard cap on the cached and the retired textures together: when the chunks overlapping the view
+ * 			 do not fit in it, for example when zoomed out far, or a chunk has to wait for a retired texture,
+ * 			 ChunkCache::prepare() returns false so the caller can draw the content directly.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ChunkCache {
+	/**
+	 * @struct	Chunk
+	 *
+	 * @brief	A rasterized chunk.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Chunk {
+		/** @brief	The rasterized region */
+		std::unique_ptr<sf::RenderTexture> texture;
+		/** @brief	Position of the chunk in the LRU order */
+		std::list<int64_t>::iterator lru;
+		/** @brief	Stamp of the last frame the chunk overlapped the view */
+		uint32_t used = 0;
+	};
+
+	/** @brief	Width and height of a chunk in world units and texels */
+	unsigned chunkSize;
+
+	/** @brief	Maximum amount of bytes used by the chunk textures */
+	std::size_t budget;
+
+	/** @brief	The cached chunks, keyed by the packed chunk coordinate */
+	std::unordered_map<int64_t, Chunk> chunks;
+
+	/** @brief	Chunk keys from most to least recently drawn */
+	std::list<int64_t> lru;
+
+	/** @brief	Stamp of the current frame */
+	uint32_t frame = 0;
+
+	/** @brief	Keys of the chunks overlapping the view in the current frame */
+	std::vector<int64_t> visible;
+
+	/** @brief	Amount of frames a dropped chunk texture is kept before it is reused or destroyed */
+	static const uint32_t retireFrames = 3;
+
+	/** @brief	Textures of dropped chunks together with the frame they were dropped in, oldest first */
+	std::list<std::pair<uint32_t, std::unique_ptr<sf::RenderTexture>>> retired;
+
+	/**
+	 * @fn	void ChunkCache::retire(std::unordered_map<int64_t, Chunk>::iterator chunk)
+	 *
+	 * @brief	Drops a chunk, keeping its texture until no frame in flight can use it anymore
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	chunk	The chunk to drop.
+	 */
+
+	void retire(std::unordered_map<int64_t, Chunk>::iterator chunk) {
+		retired.emplace_back(frame, std::move(chunk->second.texture));
+		lru.erase(chunk->second.lru);
+		chunks.erase(chunk);
+	}
+
+	/**
+	 * @fn	static int64_t ChunkCache::chunkKey(int32_t x, int32_t y)
+	 *
+	 * @brief	Packs a chunk coordinate into a single key
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	x	The chunk column.
+	 * @param	y	The chunk row.
+	 *
+	 * @return	The chunk key.
+	 */
+
+	static int64_t chunkKey(int32_t x, int32_t y) {
+		return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+	}
+
+	/**
+	 * @fn	sf::Vector2f ChunkCache::chunkOrigin(int64_t key) const
+	 *
+	 * @brief	Gets the world position of the top left corner of a chunk
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The chunk key.
+	 *
+	 * @return	The world position.
+	 */
+
+	sf::Vector2f chunkOrigin(int64_t key) const {
+		return sf::Vector2f(
+			static_cast<float>(static_cast<int32_t>(key >> 32)) * chunkSize,
+			static_cast<float>(static_cast<int32_t>(key & 0xFFFFFFFF)) * chunkSize
+		);
+	}
+
+	/**
+	 * @fn	std::size_t ChunkCache::chunkBytes() const
+	 *
+	 * @brief	Gets the amount of bytes used by a single chunk texture
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The byte count.
+	 */
+
+	std::size_t chunkBytes() const {
+		return static_cast<std::size_t>(chunkSize) * chunkSize * 4;
+	}
+
+	/**
+	 * @fn	template<class F> void ChunkCache::forEachChunk(const sf::FloatRect& area, F func) const
+	 *
+	 * @brief	Invokes func with the key of every chunk overlapping area
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	F	Callable taking (int64_t key).
+	 * @param	area	The area in world coordinates.
+	 * @param	func	The function to invoke.
+	 */
+
+	template<class F>
+	void forEachChunk(const sf::FloatRect& area, F func) const {
+		const int32_t left = static_cast<int32_t>(std::floor(area.left / chunkSize));
+		const int32_t top = static_cast<int32_t>(std::floor(area.top / chunkSize));
+		const int32_t right = static_cast<int32_t>(std::floor((area.left + area.width) / chunkSize));
+		const int32_t bottom = static_cast<int32_t>(std::floor((area.top + area.height) / chunkSize));
+
+		for (int32_t y = top; y <= bottom; y++) {
+			for (int32_t x = left; x <= right; x++) {
+				func(chunkKey(x, y));
+			}
+		}
+	}
+
+	/**
+	 * @fn	std::unique_ptr<sf::RenderTexture> ChunkCache::takeTexture()
+	 *
+	 * @brief	Reuses a retired texture that no frame in flight can sample anymore, or creates a new texture if
+	 * 			the chunks and the retired textures leave room for it in the budget. Otherwise the least recently
+	 * 			drawn chunk outside the view is dropped, so its texture can be reused a few frames later.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The texture, nullptr if the budget is reached or it could not be created.
+	 */
+
+	std::unique_ptr<sf::RenderTexture> takeTexture() {
+		if (!retired.empty() && retired.front().first + retireFrames <= frame) {
+			std::unique_ptr<sf::RenderTexture> texture = std::move(retired.front().second);
+			retired.pop_front();
+
+			return texture;
+		}
+
+		if ((chunks.size() + retired.size() + 1) * chunkBytes() > budget) {
+			if (!lru.empty()) {
+				auto victim = chunks.find(lru.back());
+
+				if (victim->second.used != frame) {
+					retire(victim);
+				}
+			}
+
+			return nullptr;
+		}
+
+		std::unique_ptr<sf::RenderTexture> texture(new sf::RenderTexture());
+
+		if (!texture->create(chunkSize, chunkSize)) {
+			return nullptr;
+		}
+
+		return texture;
+	}
+
+public:
+
+	/**
+	 * @fn	ChunkCache::ChunkCache(unsigned chunkSize = 512, std::size_t budget = 32 * 1024 * 1024)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	chunkSize	(Optional) Width and height of a chunk in world units.
+	 * @param	budget   	(Optional) Maximum amount of bytes used by the chunk textures.
+	 */
+
+	ChunkCache(unsigned chunkSize = 512, std::size_t budget = 32 * 1024 * 1024) : chunkSize(chunkSize), budget(budget) { }
+
+	/**
+	 * @fn	void ChunkCache::invalidate(const sf::FloatRect& area)
+	 *
+	 * @brief	Drops the chunks overlapping area, they are rasterized again the next time they are visible
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	area	The changed area in world coordinates.
+	 */
+
+	void invalidate(const sf::FloatRect& area) {
+		forEachChunk(area, [&](int64_t key) {
+			auto it = chunks.find(key);
+
+			if (it != chunks.end()) {
+				retire(it);
+			}
+		});
+	}
+
+	/**
+	 * @fn	void ChunkCache::clear()
+	 *
+	 * @brief	Drops all chunks
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		while (!chunks.empty()) {
+			retire(chunks.begin());
+		}
+	}
+
+	/**
+	 * @fn	bool ChunkCache::prepare(const sf::View& view, const std::function<void(sf::RenderTarget&)>& rasterize)
+	 *
+	 * @brief	Rasterizes the chunks overlapping view that are not cached yet
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	view	 	The view that will be drawn.
+	 * @param	rasterize	Draws the cached content to the given target, the view of the target is set to the chunk.
+	 *
+	 * @return	False if the chunks overlapping view do not fit in the budget, or not all of them could be rasterized because
+	 * 			retired textures still take up the budget. ChunkCache::draw() is not to be used in that case.
+	 */
+
+	bool prepare(const sf::View& view, const std::function<void(sf::RenderTarget&)>& rasterize) {
+		const sf::FloatRect viewRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+		frame++;
+		visible.clear();
+
+		std::size_t visibleCount = 0;
+
+		forEachChunk(viewRect, [&](int64_t) {
+			visibleCount++;
+		});
+
+		if (visibleCount * chunkBytes() > budget) {
+			return false;
+		}
+
+		bool complete = true;
+
+		forEachChunk(viewRect, [&](int64_t key) {
+			auto it = chunks.find(key);
+
+			if (it == chunks.end()) {
+				std::unique_ptr<sf::RenderTexture> texture = takeTexture();
+
+				if (!texture) {
+					complete = false;
+					return;
+				}
+
+				const sf::Vector2f origin = chunkOrigin(key);
+
+				texture->setView(sf::View(sf::FloatRect(origin.x, origin.y, static_cast<float>(chunkSize), static_cast<float>(chunkSize))));
+				texture->clear(sf::Color::Transparent);
+				rasterize(*texture);
+				texture->display();
+
+				lru.push_front(key);
+				it = chunks.emplace(key, Chunk()).first;
+				it->second.texture = std::move(texture);
+				it->second.lru = lru.begin();
+			}
+			else {
+				lru.splice(lru.begin(), lru, it->second.lru);
+			}
+
+			it->second.used = frame;
+			visible.push_back(key);
+		});
+
+		return complete;
+	}
+
+	/**
+	 * @fn	void ChunkCache::draw(RenderList& target, sf::RenderStates states) const
+	 *
+	 * @brief	Draws the chunks that were prepared for the current frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The render list.
+	 * @param 		  	states	The render states.
+	 */
+
+	void draw(RenderList& target, sf::RenderStates states) const {
+		for (int64_t key : visible) {
+			auto it = chunks.find(key);
+
+			if (it != chunks.end()) {
+				sf::Sprite sprite(it->second.texture->getTexture());
+
+				sprite.setPosition(chunkOrigin(key));
+				target.draw(sprite, states);
+			}
+		}
+	}
+
+	/**
+	 * @fn	std::size_t ChunkCache::getResidentBytes() const
+	 *
+	 * @brief	Gets the amount of bytes used by the cached chunk textures
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The byte count.
+	 */
+
+	std::size_t getResidentBytes() const {
+		return (chunks.size() + retired.size()) * chunkBytes();
+	}
+};
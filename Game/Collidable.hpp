@@ -5,7 +5,6 @@
 #include "GameObject.hpp"
 #include "MovingObject.hpp"
 #include "Collision.hpp"
-#include "ClickableRectangle.hpp"
 
 /**
  * @class	Collidable
@@ -73,7 +72,21 @@ public:
 
 	void resolveCollision(Collidable& other, Collision collision) {
 		onCollide(other);
+		resolveCollision(collision);
+	}
+
+	/**
+	* @fn	void Collidable::resolveCollision(Collision collision)
+	*
+	* @brief	Resolves a collision with level geometry that is not a Collidable, without invoking Collidable::onCollide(Collidable&)
+	*
+	* @author	Julian
+	* @date	2026-10-19
+	*
+	* @param	collision	Collision information required for resolving the collision
+	*/
 
+	void resolveCollision(Collision collision) {
 		sf::Vector2f mtv;
 		if ((collision.getDelta().y > 30 && collision.getDelta().y < -20) || getVelocity().y == 0) {//to check if the bottom type of resolving is needed
 			if ((collision.getIntersect().x - collision.getIntersect().y) > -10) {//-10 is the treshold of detecting if the horizontal collision is worth resolvin
@@ -44,6 +44,27 @@ public:
 		intersect = { abs(delta.x) - (otherHalfSize.x + thisHalfSize.x), abs(delta.y) - (otherHalfSize.y + thisHalfSize.y) };
 	};
 
+	/**
+	 * @fn	Collision::Collision(const sf::RectangleShape& lhs, const sf::Vector2f& otherPosition, const sf::Vector2f& otherHalfSize)
+	 *
+	 * @brief	Constructor for a collision with an area that is not a shape, such as a block entity
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	lhs			 	GameObject1 to calculate a collision for relative to the area
+	 * @param	otherPosition	Center of the area
+	 * @param	otherHalfSize	Half of the size of the area
+	 */
+
+	Collision(const sf::RectangleShape& lhs, const sf::Vector2f& otherPosition, const sf::Vector2f& otherHalfSize) {
+		sf::Vector2f thisPosition = lhs.getPosition();
+		sf::Vector2f thisHalfSize = lhs.getSize() / 2.0f;
+
+		delta = { otherPosition.x - thisPosition.x, otherPosition.y - thisPosition.y };
+		intersect = { abs(delta.x) - (otherHalfSize.x + thisHalfSize.x), abs(delta.y) - (otherHalfSize.y + thisHalfSize.y) };
+	}
+
 	/**
 	 * @fn	Collision::Collision(const sf::Vector2f delta, const sf::Vector2f intersect)
 	 *
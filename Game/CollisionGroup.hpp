@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_map>
+
 #include "Collidable.hpp"
 #include "InteractionGroup.hpp"
 
@@ -16,6 +18,9 @@ class CollisionGroup : public std::vector<Collidable*>, public InteractionGroup
 	/** @brief	The primary collidable to compare with all otherCollidables */
 	Collidable* primaryCollidable;
 
+	/** @brief	Position of every collidable in the vector, so it can be erased without searching */
+	std::unordered_map<const Collidable*, std::size_t> positions;
+
 public:
 
 	/**
@@ -87,13 +92,15 @@ public:
 	 */
 
 	void add(Collidable& collidable) {
-		push_back(&collidable);
+		if (positions.emplace(&collidable, size()).second) {
+			push_back(&collidable);
+		}
 	}
 
 	/**
-	 * @fn	void CollisionGroup::erase(Collidable& collidable)
+	 * @fn	void CollisionGroup::erase(Collidable& collidable) override
 	 *
-	 * @brief	Erases the given collidable
+	 * @brief	Erases the given collidable by moving the last collidable into its place
 	 *
 	 * @author	Jeffrey
 	 * @date	1/31/2018
@@ -101,14 +108,60 @@ public:
 	 * @param [in,out]	collidable	The collidable.
 	 */
 
-	void erase(Collidable& collidable) {
-		auto it = std::find(begin(), end(), &collidable);
+	void erase(Collidable& collidable) override {
+		if (primaryCollidable == &collidable) {
+			primaryCollidable = nullptr;
+		}
+
+		auto it = positions.find(&collidable);
+
+		if (it != positions.end()) {
+			const std::size_t position = it->second;
+			positions.erase(it);
 
-		if (it != end()) {
-			std::vector<Collidable*>::erase(it);
+			if (position != size() - 1) {
+				(*this)[position] = back();
+				positions[back()] = position;
+			}
+
+			pop_back();
 		}
 	}
 
+	/**
+	 * @fn	void CollisionGroup::erase(const std::unordered_set<const Collidable*>& collidables) override
+	 *
+	 * @brief	Erases the given collidables in a single pass, keeping the order of the others
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	collidables	The collidables.
+	 */
+
+	void erase(const std::unordered_set<const Collidable*>& collidables) override {
+		if (collidables.count(primaryCollidable) != 0) {
+			primaryCollidable = nullptr;
+		}
+
+		std::size_t kept = 0;
+
+		for (std::size_t position = 0; position < size(); position++) {
+			Collidable* collidable = (*this)[position];
+
+			if (collidables.count(collidable) != 0) {
+				positions.erase(collidable);
+				continue;
+			}
+
+			(*this)[kept] = collidable;
+			positions[collidable] = kept;
+			kept++;
+		}
+
+		resize(kept);
+	}
+
 	/**
 	 * @fn	void CollisionGroup::resolve()
 	 *
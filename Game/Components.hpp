@@ -0,0 +1,140 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <cstdint>
+
+/**
+ * @struct	TransformComponent
+ *
+ * @brief	Position of an entity, the center of its AABBComponent.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct TransformComponent {
+	/** @brief	The position */
+	sf::Vector2f position;
+};
+
+/**
+ * @struct	VelocityComponent
+ *
+ * @brief	Velocity of an entity, integrated into its TransformComponent.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct VelocityComponent {
+	/** @brief	The velocity in units per second */
+	sf::Vector2f velocity;
+
+	/** @brief	The acceleration in units per second squared, gravity for falling entities */
+	sf::Vector2f acceleration;
+};
+
+/**
+ * @struct	AABBComponent
+ *
+ * @brief	Axis aligned extent of an entity around its TransformComponent.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct AABBComponent {
+	/** @brief	Half of the size */
+	sf::Vector2f halfSize;
+
+	/** @brief	True if other entities collide with it */
+	bool solid = true;
+};
+
+/**
+ * @struct	SpriteComponent
+ *
+ * @brief	Textured or coloured rectangle covering the AABBComponent of an entity.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct SpriteComponent {
+	/** @brief	The texture, nullptr for a plain colour */
+	const sf::Texture* texture = nullptr;
+
+	/** @brief	Area of the texture to show, the whole texture if empty */
+	sf::IntRect textureRect;
+
+	/** @brief	Multiplied with the texture */
+	sf::Color color = sf::Color::White;
+};
+
+/**
+ * @struct	ClickableComponent
+ *
+ * @brief	Marks an entity that can be picked with the mouse.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct ClickableComponent {
+	/** @brief	True while the mouse is over the entity */
+	bool hovered = false;
+};
+
+/**
+ * @struct	TriggerComponent
+ *
+ * @brief	Area that reports overlaps instead of colliding, for instance a power-up.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct TriggerComponent {
+	/** @brief	Payload of the trigger, for instance the amount a heal heals */
+	float value = 0;
+
+	/** @brief	True once the trigger has been entered */
+	bool triggered = false;
+};
+
+/**
+ * @struct	SerializableComponent
+ *
+ * @brief	Marks an entity that is written back to the map file.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct SerializableComponent {
+	/** @brief	The item name in the map file */
+	std::string type;
+};
+
+/**
+ * @struct	ComponentTraits
+ *
+ * @brief	Assigns every component type a bit in an archetype mask.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ *
+ * @tparam	T	The component type.
+ */
+
+template<class T>
+struct ComponentTraits;
+
+template<> struct ComponentTraits<TransformComponent> { static constexpr uint32_t bit = 1 << 0; };
+template<> struct ComponentTraits<VelocityComponent> { static constexpr uint32_t bit = 1 << 1; };
+template<> struct ComponentTraits<AABBComponent> { static constexpr uint32_t bit = 1 << 2; };
+template<> struct ComponentTraits<SpriteComponent> { static constexpr uint32_t bit = 1 << 3; };
+template<> struct ComponentTraits<ClickableComponent> { static constexpr uint32_t bit = 1 << 4; };
+template<> struct ComponentTraits<TriggerComponent> { static constexpr uint32_t bit = 1 << 5; };
+template<> struct ComponentTraits<SerializableComponent> { static constexpr uint32_t bit = 1 << 6; };
@@ -1,11 +1,14 @@
 #pragma once
 
-#include <iomanip>
 #include <memory>
+#include <algorithm>
+#include <map>
+#include <set>
 #include "State.hpp"
 #include "Statemachine.hpp"
 #include "SubtitleParser.hpp"
 #include "Label.hpp"
+#include "ImagePrefetcher.hpp"
 
 /**
  * @class	Cutscene
@@ -21,9 +24,12 @@ class Cutscene : public State {
 	/** @brief	The statemachine */
 	Statemachine& statemachine;
 
-	/** @brief	Vector containing subtitles for the cutscene. */
+	/** @brief	Vector containing subtitles for the cutscene, sorted by start time. */
 	SubtitleVector subtitles;
 
+	/** @brief	Index of the first subtitle that has not ended yet. */
+	std::size_t cursor = 0;
+
 	/** @brief	The subtitle file parser. */
 	SubtitleParser parser;
 
@@ -33,8 +39,8 @@ class Cutscene : public State {
 	/** @brief	The clock used for timing the subtitle display events. */
 	sf::Clock clock;
 
-	/** @brief	The last subtitle update time. */
-	sf::Time lastSubtitleUpdate;
+	/** @brief	Milliseconds added to the clock, moves the cutscene time when seeking. */
+	int32_t timeOffset = 0;
 
 	/** @brief	The key released connection */
 	EventConnection keyReleasedConnection;
@@ -42,11 +48,182 @@ class Cutscene : public State {
 	/** @brief	The background */
 	Body background;
 
-	/** @brief	The texture */
-	sf::Texture texture;
+	/** @brief	Reference to the image of the current subtitle, keeps it resident while it is displayed */
+	AssetReference image;
 
 	/** @brief	True if displaying an subtitle */
 	bool displaying = false;
+
+	/** @brief	Decodes the images of upcoming subtitles */
+	ImagePrefetcher prefetcher;
+
+	/** @brief	Amount of subtitles from the cursor on whose images are prefetched */
+	const std::size_t prefetchDistance = 3;
+
+	/** @brief	Cursor the prefetch window was selected for */
+	std::size_t prefetchCursor = static_cast<std::size_t>(-1);
+
+	/** @brief	Image paths of the subtitles in the prefetch window */
+	std::set<std::string> wantedImages;
+
+	/** @brief	Image paths requested from the prefetcher that have not been polled yet */
+	std::set<std::string> pendingImages;
+
+	/** @brief	References to the uploaded images in the prefetch window, keeping them resident until their subtitles have ended */
+	std::map<std::string, AssetReference> prefetchedImages;
+
+	/**
+	 * @fn	void Cutscene::showImage(const std::string& path)
+	 *
+	 * @brief	Displays the image at path on the background, evicting the previously displayed image.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	path	The image path, also used as asset identifier.
+	 */
+
+	void showImage(const std::string& path) {
+		std::string previousImage = image.getId();
+
+		try {
+			image = AssetReference(path, path);
+			background.setTexture(&AssetManager::instance()->getTexture(path), true);
+		}
+		catch (AssetNotFoundByPathException& ex) {
+			std::cout << ex.what() << std::endl;
+			return;
+		}
+
+		if (previousImage != path) {
+			// Frames that are still being rendered may show the previous image.
+			statemachine.finishRendering();
+			AssetManager::instance()->unload(previousImage);
+		}
+	}
+
+	/**
+	 * @fn	void Cutscene::updatePrefetch()
+	 *
+	 * @brief	Requests the images of the subtitles in the prefetch window and releases the images of the subtitles that have left it
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void updatePrefetch() {
+		if (cursor == prefetchCursor) {
+			return;
+		}
+
+		prefetchCursor = cursor;
+		wantedImages.clear();
+
+		for (std::size_t i = cursor; i < subtitles.size() && i < cursor + prefetchDistance; i++) {
+			const std::string& imagePath = subtitles[i].getImagePath();
+
+			if (imagePath.length() > 0 && imagePath.compare("NONE") != 0) {
+				wantedImages.insert(imagePath);
+			}
+		}
+
+		for (const std::string& imagePath : wantedImages) {
+			if (prefetchedImages.find(imagePath) == prefetchedImages.end() && pendingImages.insert(imagePath).second) {
+				prefetcher.request(imagePath);
+			}
+		}
+
+		for (auto it = prefetchedImages.begin(); it != prefetchedImages.end();) {
+			if (wantedImages.find(it->first) == wantedImages.end()) {
+				const std::string imagePath = it->first;
+				it = prefetchedImages.erase(it);
+
+				// Left untouched while it is still displayed, showImage() evicts it once it is replaced.
+				AssetManager::instance()->unload(imagePath);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+	/**
+	 * @fn	void Cutscene::uploadPrefetched()
+	 *
+	 * @brief	Uploads at most one decoded image to a texture, spreading the uploads over the frames
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void uploadPrefetched() {
+		ImagePrefetcher::Result result;
+
+		if (!prefetcher.poll(result)) {
+			return;
+		}
+
+		pendingImages.erase(result.path);
+
+		if (!result.loaded) {
+			std::cout << "Cannot prefetch cutscene image '" << result.path << "'" << std::endl;
+		}
+		else if (wantedImages.find(result.path) != wantedImages.end() && prefetchedImages.find(result.path) == prefetchedImages.end()) {
+			AssetManager::instance()->loadTexture(result.path, result.image, result.path);
+			prefetchedImages.emplace(result.path, AssetReference(result.path));
+		}
+	}
+
+	/**
+	 * @fn	int32_t Cutscene::getTime() const
+	 *
+	 * @brief	Gets the cutscene time
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	Milliseconds since the start of the cutscene.
+	 */
+
+	int32_t getTime() const {
+		return clock.getElapsedTime().asMilliseconds() + timeOffset;
+	}
+
+	/**
+	 * @fn	void Cutscene::showSubtitle(std::size_t index)
+	 *
+	 * @brief	Displays the subtitle at index, together with the image of the last subtitle up to index that sets one
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	index	Index of the subtitle.
+	 */
+
+	void showSubtitle(std::size_t index) {
+		subtitleText.setText(subtitles[index].getText());
+		subtitleText.setOutlineThicknes(2.0f);
+
+		// Subtitles without an image keep the previous one, which after seeking is not necessarily the displayed one.
+		for (std::size_t i = index + 1; i-- > 0;) {
+			const std::string& imagePath = subtitles[i].getImagePath();
+
+			if (imagePath.length() > 0) {
+				if (imagePath.compare("NONE") == 0) {
+					background.setSize({ 0, 0 });
+				}
+				else {
+					background.setSize({ 1280, 720 });
+					showImage(imagePath);
+				}
+
+				break;
+			}
+		}
+
+		displaying = true;
+	}
+
 public:
 
 	/**
@@ -75,9 +252,14 @@ public:
 	 */
 
 	void entry() override {
+		requireAsset("arial");
+
+		// Build the game while the cutscene plays, so skipping or finishing it does not wait for the map to load.
+		statemachine.prewarmState("running");
+
 		// Prepare the cutscene.
 		subtitleText.setFont(AssetManager::instance()->getFont("arial"));
-		subtitleText.setPosition({50.0f, statemachine.window.getSize().y - 80.0f});
+		subtitleText.setPosition({50.0f, statemachine.renderList.getSize().y - 80.0f});
 		subtitleText.setColor(sf::Color::White);
 		subtitleText.setText("");
 
@@ -88,6 +270,9 @@ public:
 			if (key == sf::Keyboard::Key::Escape) {
 				statemachine.doTransition("running");
 			}
+			else if (key == sf::Keyboard::Key::Space) {
+				skipToNext();
+			}
 		});
 
 		try {
@@ -101,14 +286,18 @@ public:
 			return;
 		}
 
-		// Reserve the result.
-		if (subtitles.size() > 1) {
-			std::reverse(subtitles.begin(), subtitles.end());
-		}
-		else {
+		if (subtitles.empty()) {
 			// No subtitles available, skip the cutscene.
 			statemachine.doTransition("running");
+			return;
 		}
+
+		clock.restart();
+		timeOffset = 0;
+		cursor = 0;
+		displaying = false;
+
+		updatePrefetch();
 	}
 
 	/**
@@ -124,9 +313,70 @@ public:
 		// Empty subtitles vector
 		subtitles.clear();
 
+		// Evict the last displayed image and the prefetched ones, cutscene images are not shared with other states.
+		std::string lastImage = image.getId();
+		image = AssetReference();
+		AssetManager::instance()->unload(lastImage);
+
+		prefetcher.clear();
+		pendingImages.clear();
+		wantedImages.clear();
+		prefetchCursor = static_cast<std::size_t>(-1);
+
+		std::vector<std::string> prefetchedIds;
+
+		for (const auto& entry : prefetchedImages) {
+			prefetchedIds.push_back(entry.first);
+		}
+
+		prefetchedImages.clear();
+
+		for (const std::string& id : prefetchedIds) {
+			AssetManager::instance()->unload(id);
+		}
+
 		keyReleasedConnection.disconnect();
 	}
 
+	/**
+	 * @fn	void Cutscene::seek(int32_t time)
+	 *
+	 * @brief	Moves the cutscene to time, the subtitle at that time is displayed on the next update
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	time	Milliseconds since the start of the cutscene.
+	 */
+
+	void seek(int32_t time) {
+		timeOffset = time - clock.getElapsedTime().asMilliseconds();
+
+		// Subtitles do not overlap, so sorted by start time they are sorted by end time as well.
+		cursor = std::partition_point(subtitles.begin(), subtitles.end(), [time](const SubtitleItem& item) {
+			return item.getEnd() <= time;
+		}) - subtitles.begin();
+
+		subtitleText.setText("");
+		displaying = false;
+	}
+
+	/**
+	 * @fn	void Cutscene::skipToNext()
+	 *
+	 * @brief	Seeks to the start of the next subtitle
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void skipToNext() {
+		if (cursor < subtitles.size()) {
+			const SubtitleItem& item = subtitles[cursor];
+			seek(displaying ? item.getEnd() : item.getStart());
+		}
+	}
+
 	/**
 	 * @fn	void Cutscene::update(const float elapsedTime) override
 	 *
@@ -139,54 +389,28 @@ public:
 	 */
 
 	void update(const float elapsedTime) override {
-		if ((clock.getElapsedTime().asSeconds() - lastSubtitleUpdate.asSeconds()) > 0) {
-			if (subtitles.size() > 0) {
-				auto item = subtitles.back();
-
-				std::tm subTimeStart, subTimeEnd;
-
-				std::istringstream ssStart(item->getTimeStart());
-				std::istringstream ssStop(item->getTimeEnd());
-
-				// Parse the start and end time into an std::td (time) object.
-				ssStart >> std::get_time(&subTimeStart, "%H:%M:%S");
-				ssStop >> std::get_time(&subTimeEnd, "%H:%M:%S");
-
-				if (!displaying && clock.getElapsedTime().asSeconds() >= (subTimeStart.tm_min * 60) + subTimeStart.tm_sec) {
-					subtitleText.setText(item->getText());
-                    subtitleText.setOutlineThicknes(2.0f);
-
-					if (item->getImagePath().length() > 0) {
-						if (item->getImagePath().compare("NONE") == 0) {
-							background.setSize({ 0, 0 });
-						}
-						else {
-							background.setSize({ 1280, 720 });
-							
-							if (texture.loadFromFile(item->getImagePath())) {
-								background.setTexture(&texture, true);
-							}
-						}
-					}
-
-					displaying = true;
-				}
+		const int32_t time = getTime();
 
-				if (clock.getElapsedTime().asSeconds() >= (subTimeEnd.tm_min * 60) + subTimeEnd.tm_sec) {
-					subtitleText.setText("");
-					
-					subtitles.pop_back();
-					displaying = false;
-				}
-			}
-			else if (subtitleText.getText() == "") {
-				// Done with the cutscene, transition to running state.
-				statemachine.doTransition("running");
-			}
+		while (cursor < subtitles.size() && subtitles[cursor].getEnd() <= time) {
+			subtitleText.setText("");
+			cursor++;
+			displaying = false;
+		}
+
+		if (cursor == subtitles.size()) {
+			// Done with the cutscene, transition to running state.
+			statemachine.doTransition("running");
+			return;
+		}
+
+		updatePrefetch();
+		uploadPrefetched();
 
+		if (!displaying && time >= subtitles[cursor].getStart()) {
+			showSubtitle(cursor);
 		}
 
-		statemachine.window.draw(background);
-		statemachine.window.draw(subtitleText);
+		statemachine.renderList.draw(background);
+		statemachine.renderList.draw(subtitleText);
 	}
 };
\ No newline at end of file
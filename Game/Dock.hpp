@@ -7,6 +7,7 @@
 #include "BaseFactory.hpp"
 #include "Button.hpp"
 #include "ObjectSelector.hpp"
+#include "RenderList.hpp"
 
 /**
  * @class	Dock
@@ -28,8 +29,8 @@ private:
 	/** @brief	The selected item */
 	ObjectSelector& selection;
 
-	/** @brief	The display window */
-	sf::RenderTarget &window;
+	/** @brief	The render list the dock is displayed on */
+	RenderList &window;
 
 	/** @brief	The dock start x and y coordinates */
 	float dockStartX = 25.0f, dockStartY = 630.0f; // 685
@@ -44,7 +45,7 @@ private:
 public:
 
 	/**
-	 * @fn	Dock::Dock(RectangleContainer &_rectangles, sf::RenderTarget &_window)
+	 * @fn	Dock::Dock(RectangleContainer &_rectangles, RenderList &_window)
 	 *
 	 * @brief	Constructor
 	 *
@@ -52,10 +53,10 @@ public:
 	 * @date	26-1-2018
 	 *
 	 * @param [in,out]	_rectangles	The rectangles.
-	 * @param [in,out]	_window	   	The window.
+	 * @param [in,out]	_window	   	The render list.
 	 */
 
-	Dock(Map &_map, sf::RenderTarget &_window, ObjectSelector& selection) : map(_map), window(_window), selection(selection) {
+	Dock(Map &_map, RenderList &_window, ObjectSelector& selection) : map(_map), window(_window), selection(selection) {
 		game.mouse.mouseLeftButtonDown.connect([this](const sf::Vector2i mousePos) {
 			selectRectangle(mousePos);
 		});
@@ -100,16 +101,15 @@ public:
 	void selectRectangle(sf::Vector2i mousePos) {
 		for (Body& rectangle : rectanglesTemplates) {
 			if (rectangle.getGlobalBounds().contains(static_cast<sf::Vector2f>(mousePos))) {
-				Body* temp = new Body();
+				Body* temp = &map.createObject<Body>();
 
-				map.addObject(temp);
-				map.addDrawable(temp);
-
-				temp->setPosition(game.window->mapPixelToCoords(mousePos));
+				temp->setPosition(game.renderList->mapPixelToCoords(mousePos));
 				temp->setTexture(rectangle.getTexture());
 				temp->setTextureRect(rectangle.getTextureRect());
 				temp->setSize(rectangle.getSize());
 
+				map.addStaticGeometry(*temp);
+
 				selection.select(temp);
 
 				return;
@@ -3,31 +3,373 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <mutex>
+
+#include "SpatialGrid.hpp"
+#include "RenderList.hpp"
+#include "Renderable.hpp"
+
+/**
+ * @enum	CullMode
+ *
+ * @brief	Values that describe how a drawable in a DrawableGroup is tested against the view.
+ */
+
+enum class CullMode {
+	/** @brief	Indexed once in the spatial index, DrawableGroup::update(sf::Drawable&) has to be called after moving it */
+	Static,
+	/** @brief	Bounds are tested against the view every frame, for moving actors */
+	Dynamic,
+	/** @brief	Always drawn, for overlays that are positioned relative to the view such as Label */
+	Never
+};
+
+/**
+ * @enum	RenderLayer
+ *
+ * @brief	Values that describe in which pass a drawable in a DrawableGroup is drawn, from back to front.
+ */
+
+enum class RenderLayer {
+	/** @brief	Behind everything, such as the background image */
+	Background,
+	/** @brief	Level geometry and objects placed in the level */
+	Level,
+	/** @brief	The player and the antagonists */
+	Actors,
+	/** @brief	Particles and other effects in front of the actors */
+	Effects,
+	/** @brief	Overlays that are positioned relative to the view */
+	Hud
+};
 
 /**
  * @class	DrawableGroup
  *
  * @brief	A drawable group.
+ * 			Drawables are drawn per RenderLayer, ordered by their z-value within a layer, skipping the ones that are outside of the view of the render target.
+ * 			Drawables with the same layer and z-value are drawn in insertion order; where they do not overlap, drawables with the same texture
+ * 			are drawn after each other so RenderList can merge them.
  *
  * @author	Jeffrey
  * @date	2/1/2018
  */
 
 class DrawableGroup : public std::vector<sf::Drawable*> {
+	/**
+	 * @struct	Entry
+	 *
+	 * @brief	Culling information of a drawable, stored at the same index as the drawable.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Entry {
+		/** @brief	The cull mode */
+		CullMode mode;
+		/** @brief	The layer the drawable is drawn in */
+		RenderLayer layer;
+		/** @brief	Order within the layer, higher values are drawn in front */
+		float z;
+		/** @brief	The global bounds the drawable was indexed with, only used for CullMode::Static */
+		sf::FloatRect bounds;
+		/** @brief	Stamp of the last draw that visited this entry, used to deduplicate grid results */
+		uint32_t visited = 0;
+	};
+
+	/** @brief	Culling information, parallel to the drawables */
+	std::vector<Entry> entries;
+
+	/** @brief	Spatial index of the drawables with CullMode::Static */
+	SpatialGrid staticIndex;
+
+	/** @brief	Indices of the drawables that are not in the spatial index */
+	std::vector<std::size_t> unindexed;
+
+	/** @brief	Stamp of the current draw */
+	uint32_t drawStamp = 0;
+
+	/**
+	 * @struct	Visible
+	 *
+	 * @brief	A drawable that is visible in the current draw, with its sort key.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Visible {
+		/** @brief	The layer */
+		RenderLayer layer;
+		/** @brief	The z-value */
+		float z;
+		/** @brief	The texture the drawable is drawn with, nullptr if unknown */
+		const sf::Texture* texture;
+		/** @brief	Index of the drawable */
+		std::size_t index;
+		/** @brief	The global bounds, only valid if hasBounds is true */
+		sf::FloatRect bounds;
+		/** @brief	False if the bounds of the drawable cannot be determined */
+		bool hasBounds;
+		/** @brief	Pass within the drawables of the same layer and z-value, see DrawableGroup::groupByTexture() */
+		uint32_t pass;
+	};
+
+	/** @brief	The drawables that are visible in the current draw, reused between frames */
+	std::vector<Visible> visible;
+
+	/** @brief	Spatial index of the visible drawables of the run that is being grouped, reused between frames */
+	SpatialGrid runIndex;
+
+	/**
+	 * @fn	static bool DrawableGroup::getGlobalBounds(const sf::Drawable& drawable, sf::FloatRect& bounds)
+	 *
+	 * @brief	Gets the global bounds of shapes, sprites and texts
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param 		  	drawable	The drawable.
+	 * @param [out]		bounds  	The global bounds.
+	 *
+	 * @return	False if the bounds of drawable cannot be determined.
+	 */
+
+	static bool getGlobalBounds(const sf::Drawable& drawable, sf::FloatRect& bounds) {
+		if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+			bounds = shape->getGlobalBounds();
+		}
+		else if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+			bounds = sprite->getGlobalBounds();
+		}
+		else if (const sf::Text* text = dynamic_cast<const sf::Text*>(&drawable)) {
+			std::lock_guard<std::mutex> lock(RenderList::getGlyphMutex());
+			bounds = text->getGlobalBounds();
+		}
+		else {
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @fn	static const sf::Texture* DrawableGroup::getTexture(const sf::Drawable& drawable)
+	 *
+	 * @brief	Gets the texture drawable is drawn with, used to group drawables that RenderList can merge
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	drawable	The drawable.
+	 *
+	 * @return	The texture, nullptr if drawable is untextured or its texture cannot be determined.
+	 */
+
+	static const sf::Texture* getTexture(const sf::Drawable& drawable) {
+		if (const Renderable* renderable = dynamic_cast<const Renderable*>(&drawable)) {
+			return renderable->getBatchTexture();
+		}
+		else if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+			return shape->getTexture();
+		}
+		else if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+			return sprite->getTexture();
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @fn	void DrawableGroup::addVisible(std::size_t i, const sf::FloatRect& bounds, bool hasBounds)
+	 *
+	 * @brief	Adds the drawable at index i to the visible drawables of the current draw
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	i		 	Index of the drawable.
+	 * @param	bounds   	The global bounds of the drawable.
+	 * @param	hasBounds	False if the bounds of the drawable cannot be determined.
+	 */
+
+	void addVisible(std::size_t i, const sf::FloatRect& bounds, bool hasBounds) {
+		const Entry& entry = entries[i];
+		visible.push_back({ entry.layer, entry.z, getTexture(*at(i)), i, bounds, hasBounds, 0 });
+	}
+
+	/**
+	 * @fn	void DrawableGroup::groupByTexture(std::vector<Visible>::iterator first, std::vector<Visible>::iterator last)
+	 *
+	 * @brief	Reorders a run of drawables with the same layer and z-value, sorted by index, so drawables with the same texture
+	 * 			are drawn after each other where that does not change how overlapping drawables cover each other.
+	 *
+	 * @detailed Every drawable gets a pass: the highest pass of the earlier drawables it overlaps, plus one if such a drawable
+	 * 			 has another texture. The run is then drawn by pass and texture, so an overlapping pair is either drawn in
+	 * 			 different passes or has the same texture and keeps its order within the pass.
+	 * 			 Drawables with unknown bounds or without a known texture are treated as overlapping everything.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	first	The first drawable of the run.
+	 * @param	last 	One past the last drawable of the run.
+	 */
+
+	void groupByTexture(std::vector<Visible>::iterator first, std::vector<Visible>::iterator last) {
+		runIndex.clear();
+
+		// The highest pass so far and the pass every following drawable has to come after.
+		uint32_t highest = 0;
+		uint32_t barrier = 0;
+		bool hasBarrier = false;
+
+		for (auto it = first; it != last; ++it) {
+			uint32_t pass = hasBarrier ? barrier + 1 : 0;
+
+			if (!it->hasBounds || it->texture == nullptr) {
+				pass = it == first ? 0 : highest + 1;
+				barrier = pass;
+				hasBarrier = true;
+			}
+			else {
+				runIndex.query(it->bounds, [&](std::size_t other) {
+					const Visible& placed = first[other];
+
+					if (placed.bounds.intersects(it->bounds)) {
+						pass = std::max(pass, placed.pass + (placed.texture == it->texture ? 0 : 1));
+					}
+				});
+
+				runIndex.insert(static_cast<std::size_t>(it - first), it->bounds);
+			}
+
+			it->pass = pass;
+			highest = std::max(highest, pass);
+		}
+
+		std::sort(first, last, [](const Visible& lhs, const Visible& rhs) {
+			if (lhs.pass != rhs.pass) {
+				return lhs.pass < rhs.pass;
+			}
+
+			if (lhs.texture != rhs.texture) {
+				return std::less<const sf::Texture*>()(lhs.texture, rhs.texture);
+			}
+
+			return lhs.index < rhs.index;
+		});
+	}
+
+	/**
+	 * @fn	void DrawableGroup::index(std::size_t i)
+	 *
+	 * @brief	Puts the drawable at index i in the spatial index or in the unindexed list
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	i	Index of the drawable.
+	 */
+
+	void index(std::size_t i) {
+		Entry& entry = entries[i];
+
+		if (entry.mode == CullMode::Static) {
+			getGlobalBounds(*at(i), entry.bounds);
+			staticIndex.insert(i, entry.bounds);
+		}
+		else {
+			unindexed.push_back(i);
+		}
+	}
+
+	/**
+	 * @fn	void DrawableGroup::rebuildIndex()
+	 *
+	 * @brief	Rebuilds the spatial index, required after indices have shifted
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void rebuildIndex() {
+		staticIndex.clear();
+		unindexed.clear();
+
+		for (std::size_t i = 0; i < size(); i++) {
+			index(i);
+		}
+	}
+
 public:
 	/**
-	* @fn	void CollisionGroup::add(Collidable& collidable)
+	 * @struct	Snapshot
+	 *
+	 * @brief	The drawables of a group with their layers and cull modes, restored with DrawableGroup::restore().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Snapshot {
+		/** @brief	The drawables */
+		std::vector<sf::Drawable*> drawables;
+		/** @brief	The culling and layer information, parallel to drawables */
+		std::vector<Entry> entries;
+	};
+
+	/**
+	* @fn	void DrawableGroup::add(sf::Drawable& drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f)
 	*
-	* @brief	Adds collidable to the vector of collidables to compare with primaryCollidable.
+	* @brief	Adds drawable to the group. Drawables of which the bounds cannot be determined are never culled.
 	*
 	* @author	Julian
 	* @date	2018-01-19
 	*
-	* @param [in,out]	collidable	The collidable to add.
+	* @param [in,out]	drawable	The drawable to add.
+	* @param 		  	mode		(Optional) How the drawable is tested against the view.
+	* @param 		  	layer		(Optional) The layer to draw the drawable in.
+	* @param 		  	z			(Optional) Order within the layer, higher values are drawn in front.
 	*/
 
-	void add(sf::Drawable& drawable) {
+	void add(sf::Drawable& drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f) {
+		sf::FloatRect bounds;
+
+		if (!getGlobalBounds(drawable, bounds)) {
+			mode = CullMode::Never;
+		}
+
 		push_back(&drawable);
+		entries.push_back({ mode, layer, z, bounds });
+		index(size() - 1);
+	}
+
+	/**
+	 * @fn	void DrawableGroup::update(sf::Drawable& drawable)
+	 *
+	 * @brief	Re-indexes a drawable with CullMode::Static after it has been moved or resized
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	drawable	The drawable.
+	 */
+
+	void update(sf::Drawable& drawable) {
+		auto it = std::find(std::vector<sf::Drawable*>::begin(), std::vector<sf::Drawable*>::end(), &drawable);
+
+		if (it != end()) {
+			std::size_t i = it - begin();
+
+			if (entries[i].mode == CullMode::Static) {
+				staticIndex.remove(i, entries[i].bounds);
+				index(i);
+			}
+		}
 	}
 
 	/**
@@ -45,24 +387,148 @@ public:
 		auto it = std::find(std::vector<sf::Drawable*>::begin(), std::vector<sf::Drawable*>::end(), &drawable);
 
 		if (it != end()) {
+			entries.erase(entries.begin() + (it - begin()));
 			std::vector<sf::Drawable*>::erase(it);
+			rebuildIndex();
+		}
+	}
+
+	/**
+	 * @fn	void DrawableGroup::erase(const std::unordered_set<const sf::Drawable*>& drawables)
+	 *
+	 * @brief	Erases several drawables in one pass, keeping the draw order of the others.
+	 * 			The spatial index is rebuilt once instead of once per drawable.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	drawables	The drawables.
+	 */
+
+	void erase(const std::unordered_set<const sf::Drawable*>& drawables) {
+		if (drawables.empty()) {
+			return;
 		}
+
+		std::size_t kept = 0;
+
+		for (std::size_t i = 0; i < size(); i++) {
+			if (drawables.count((*this)[i]) == 0) {
+				(*this)[kept] = (*this)[i];
+				entries[kept] = entries[i];
+				kept++;
+			}
+		}
+
+		if (kept != size()) {
+			std::vector<sf::Drawable*>::erase(begin() + kept, end());
+			entries.erase(entries.begin() + kept, entries.end());
+			rebuildIndex();
+		}
+	}
+
+	/**
+	 * @fn	Snapshot DrawableGroup::getSnapshot() const
+	 *
+	 * @brief	Captures which drawables are in the group
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The snapshot.
+	 */
+
+	Snapshot getSnapshot() const {
+		return { *this, entries };
 	}
 
 	/**
-	 * @fn	void DrawableGroup::draw(sf::RenderTarget& window)
+	 * @fn	void DrawableGroup::restore(const Snapshot& snapshot, const std::unordered_set<const sf::Drawable*>& destroyed = {})
+	 *
+	 * @brief	Restores the drawables captured by DrawableGroup::getSnapshot(), erased drawables are added again.
+	 * 			The drawables have to be alive, static ones are indexed at their current bounds.
 	 *
-	 * @brief	Draws the given window
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	snapshot 	The snapshot.
+	 * @param	destroyed	(Optional) Drawables of the snapshot that have been destroyed since, they are left out.
+	 */
+
+	void restore(const Snapshot& snapshot, const std::unordered_set<const sf::Drawable*>& destroyed = {}) {
+		std::vector<sf::Drawable*>::operator=(snapshot.drawables);
+		entries = snapshot.entries;
+
+		if (!destroyed.empty()) {
+			erase(destroyed);
+		}
+
+		rebuildIndex();
+	}
+
+	/**
+	 * @fn	void DrawableGroup::draw(RenderList& window)
+	 *
+	 * @brief	Draws the drawables that overlap the current view of window, sorted by layer, z-value and insertion order,
+	 * 			grouped by texture where drawables do not overlap
 	 *
 	 * @author	Jeffrey
 	 * @date	1/31/2018
 	 *
-	 * @param [in,out]	window	The window.
+	 * @param [in,out]	window	The render list.
 	 */
 
-	void draw(sf::RenderTarget& window) {
-		for (sf::Drawable* drawable : *this) {
-			window.draw(*drawable);
+	void draw(RenderList& window) {
+		const sf::View& view = window.getView();
+		const sf::FloatRect viewRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+		drawStamp++;
+		visible.clear();
+
+		staticIndex.query(viewRect, [&](std::size_t i) {
+			Entry& entry = entries[i];
+
+			if (entry.visited != drawStamp) {
+				entry.visited = drawStamp;
+
+				if (entry.bounds.intersects(viewRect)) {
+					addVisible(i, entry.bounds, true);
+				}
+			}
+		});
+
+		for (std::size_t i : unindexed) {
+			sf::FloatRect bounds;
+			const bool hasBounds = getGlobalBounds(*at(i), bounds);
+
+			if (entries[i].mode == CullMode::Never || (hasBounds && bounds.intersects(viewRect))) {
+				addVisible(i, bounds, hasBounds);
+			}
+		}
+
+		std::sort(visible.begin(), visible.end(), [](const Visible& lhs, const Visible& rhs) {
+			if (lhs.layer != rhs.layer) {
+				return lhs.layer < rhs.layer;
+			}
+
+			if (lhs.z != rhs.z) {
+				return lhs.z < rhs.z;
+			}
+
+			return lhs.index < rhs.index;
+		});
+
+		for (auto first = visible.begin(); first != visible.end();) {
+			auto last = std::find_if(first, visible.end(), [&](const Visible& entry) {
+				return entry.layer != first->layer || entry.z != first->z;
+			});
+
+			groupByTexture(first, last);
+			first = last;
+		}
+
+		for (const Visible& entry : visible) {
+			window.draw(*at(entry.index));
 		}
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @class	DynamicResolution
+ *
+ * @brief	Off-screen target whose resolution follows the time the GPU needs to fill it.
+ *
+ * @detailed Content is rendered into the top left part of an sf::RenderTexture the size of the window,
+ * 			 scaled down by the current resolution scale, and then stretched over the window.
+ * 			 Every DynamicResolution::sampleInterval passes one pass is measured in isolation: the queued work is finished
+ * 			 before it starts and it is finished before it is stretched, so the measurement covers only that pass.
+ * 			 The other passes never wait for the GPU. When the moving average of the measurements exceeds the budget
+ * 			 the scale is lowered, when there is enough headroom it is raised again, up to the native resolution.
+ * 			 Only the rendering thread may use a DynamicResolution.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class DynamicResolution {
+	/** @brief	The off-screen target */
+	sf::RenderTexture texture;
+
+	/** @brief	True once texture has been created */
+	bool created = false;
+
+	/** @brief	Size of the target the passes are stretched over */
+	sf::Vector2u size;
+
+	/** @brief	Size of the rendered part of texture in the current pass */
+	sf::Vector2u scaledSize;
+
+	/** @brief	The current resolution scale */
+	float scale = 1.0f;
+
+	/** @brief	The lowest resolution scale */
+	float minimumScale;
+
+	/** @brief	GPU time in seconds a pass may take */
+	float budget;
+
+	/** @brief	Moving average of the measured time of a pass in seconds */
+	float averageTime = 0.0f;
+
+	/** @brief	Amount of measurements before the scale may change again */
+	unsigned cooldown = 0;
+
+	/** @brief	Amount of passes between two measured passes */
+	static const unsigned sampleInterval = 15;
+
+	/** @brief	Amount of passes since the last measured pass */
+	unsigned passes = 0;
+
+	/** @brief	True if the current pass is measured */
+	bool sampling = false;
+
+	/** @brief	Measures the current pass */
+	sf::Clock clock;
+
+	/**
+	 * @fn	void DynamicResolution::adjust(float time)
+	 *
+	 * @brief	Updates the moving average with the time of the last measured pass and adjusts the scale
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	time	Time of the last measured pass in seconds.
+	 */
+
+	void adjust(float time) {
+		averageTime += (time - averageTime) * 0.5f;
+
+		if (cooldown > 0) {
+			cooldown--;
+			return;
+		}
+
+		if (averageTime > budget && scale > minimumScale) {
+			scale = std::max(minimumScale, scale * 0.9f);
+			cooldown = 1;
+		}
+		else if (averageTime < budget * 0.7f && scale < 1.0f) {
+			scale = std::min(1.0f, scale * 1.05f);
+			cooldown = 1;
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	DynamicResolution::DynamicResolution(float budget = 0.012f, float minimumScale = 0.5f)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	budget			(Optional) Time in seconds a measured pass may take, 12 ms leaves room for the HUD and presenting at 60 Hz.
+	 * @param	minimumScale	(Optional) The lowest resolution scale.
+	 */
+
+	DynamicResolution(float budget = 0.012f, float minimumScale = 0.5f) : minimumScale(minimumScale), budget(budget) { }
+
+	/**
+	 * @fn	sf::RenderTarget* DynamicResolution::begin(sf::Vector2u targetSize)
+	 *
+	 * @brief	Starts a pass that will be stretched over a target of targetSize
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	targetSize	Size of the target in pixels.
+	 *
+	 * @return	The off-screen target to draw the pass to, nullptr if it could not be created.
+	 * 			Views have to be set through DynamicResolution::setView().
+	 */
+
+	sf::RenderTarget* begin(sf::Vector2u targetSize) {
+		if (!created || size != targetSize) {
+			size = targetSize;
+			created = texture.create(size.x, size.y);
+			texture.setSmooth(true);
+		}
+
+		if (!created) {
+			return nullptr;
+		}
+
+		scaledSize.x = std::max(1u, static_cast<unsigned>(std::lround(size.x * scale)));
+		scaledSize.y = std::max(1u, static_cast<unsigned>(std::lround(size.y * scale)));
+
+		sampling = ++passes >= sampleInterval;
+
+		if (sampling) {
+			// Finish the work queued by earlier passes, so it is not counted towards this one.
+			glFinish();
+			passes = 0;
+		}
+
+		texture.clear();
+		clock.restart();
+
+		return &texture;
+	}
+
+	/**
+	 * @fn	void DynamicResolution::setView(const sf::View& view)
+	 *
+	 * @brief	Sets view on the off-screen target, shrinking its viewport to the rendered part
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	view	The view as it would be used on the target.
+	 */
+
+	void setView(const sf::View& view) {
+		const sf::FloatRect& viewport = view.getViewport();
+		const float scaleX = static_cast<float>(scaledSize.x) / size.x;
+		const float scaleY = static_cast<float>(scaledSize.y) / size.y;
+
+		sf::View scaled = view;
+		scaled.setViewport(sf::FloatRect(viewport.left * scaleX, viewport.top * scaleY, viewport.width * scaleX, viewport.height * scaleY));
+		texture.setView(scaled);
+	}
+
+	/**
+	 * @fn	void DynamicResolution::end(sf::RenderTarget& target)
+	 *
+	 * @brief	Finishes the pass, measures it if it is sampled and stretches it over target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The target, of the size given to DynamicResolution::begin().
+	 */
+
+	void end(sf::RenderTarget& target) {
+		texture.display();
+
+		if (sampling) {
+			// Wait for the GPU, so the measured time includes filling the pass and not just submitting it.
+			glFinish();
+			adjust(clock.getElapsedTime().asSeconds());
+		}
+
+		// The texture coordinates stay half a texel inside the rendered part, so smooth filtering never
+		// blends in the unused texels next to it.
+		const float width = static_cast<float>(size.x);
+		const float height = static_cast<float>(size.y);
+		const float right = scaledSize.x - 0.5f;
+		const float bottom = scaledSize.y - 0.5f;
+
+		const sf::Vertex quad[4] = {
+			sf::Vertex(sf::Vector2f(0, 0), sf::Vector2f(0.5f, 0.5f)),
+			sf::Vertex(sf::Vector2f(width, 0), sf::Vector2f(right, 0.5f)),
+			sf::Vertex(sf::Vector2f(width, height), sf::Vector2f(right, bottom)),
+			sf::Vertex(sf::Vector2f(0, height), sf::Vector2f(0.5f, bottom))
+		};
+
+		target.setView(sf::View(sf::FloatRect(0, 0, width, height)));
+		target.draw(quad, 4, sf::Quads, sf::RenderStates(&texture.getTexture()));
+	}
+
+	/**
+	 * @fn	float DynamicResolution::getScale() const
+	 *
+	 * @brief	Gets the current resolution scale
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The scale, 1 is native resolution.
+	 */
+
+	float getScale() const {
+		return scale;
+	}
+};
@@ -41,53 +41,12 @@ class Editor : public State {
 	EventConnection keyPressedConnection;
 	/** @brief	The key released connection */
 	EventConnection keyReleasedConnection;
-	/** @brief	The mouse left button up */
-	EventConnection mouseLeftButtonUp;
+	/** @brief	The mouse left button down connection, picks the object under the mouse */
+	EventConnection mouseLeftButtonDownConn;
+	/** @brief	The mouse left button up connection */
+	EventConnection mouseLeftButtonUpConn;
 	/** @brief	The mouse moved connection */
 	EventConnection mouseMovedConn;
-	/** @brief	The object added connection */
-	EventConnection objectAddedConn;
-	/** @brief	The object removed connection */
-	EventConnection objectRemovedConn;
-
-	/**
-	 * @struct	EditorEventBinding
-	 *
-	 * @brief	An editor event binding.
-	 *
-	 * @author	Wiebe
-	 * @date	29-1-2018
-	 */
-
-	struct EditorEventBinding {
-		/** @brief	The mouse left button down connection */
-		EventConnection mouseLeftButtonDown;
-
-		/** @brief	The mouse left button up connection */
-		EventConnection mouseLeftButtonUp;
-
-		/**
-		 * @fn	EditorEventBinding(EventConnection mouseLeftButtonDown, EventConnection mouseLeftButtonUp)
-		 *
-		 * @brief	Constructor
-		 *
-		 * @author	Wiebe
-		 * @date	29-1-2018
-		 *
-		 * @param	mouseLeftButtonDown	The mouse left button down.
-		 * @param	mouseLeftButtonUp  	The mouse left button up.
-		 */
-
-		EditorEventBinding(EventConnection mouseLeftButtonDown, EventConnection mouseLeftButtonUp) :
-			mouseLeftButtonDown(mouseLeftButtonDown),
-			mouseLeftButtonUp(mouseLeftButtonUp)
-		{ }
-	};
-
-
-	/** @brief	The editor event connection map */
-	std::map<Body*, EditorEventBinding> editorEventConnMap;
-
 
 	/** @brief	Used for object selection */
 	ObjectSelector selection;
@@ -104,51 +63,29 @@ class Editor : public State {
 	bool lControlPressed = false;
 
 	/**
-	 * @fn	void Editor::bindEditorEvents(Body& object)
-	 *
-	 * @brief	Bind editor events
+	 * @fn	Body* Editor::pick(sf::Vector2i pos)
 	 *
-	 * @author	Wiebe
-	 * @date	29-1-2018
-	 *
-	 * @param [in,out]	object	The physic object subject.
-	 */
-
-	void bindEditorEvents(Body& object) {
-		object.bindMouseEvents();
-
-		editorEventConnMap.insert(std::pair<Body*, EditorEventBinding>(&object, EditorEventBinding {
-			object.mouseLeftButtonDown.connect([&object, this]() {
-				selection.select(object);
-			}),
-
-			object.mouseLeftButtonUp.connect([&object, this]() {
-				selection.stopDrag();
-			})
-		}));
-	}
-
-	/**
-	 * @fn	void Editor::unbindEditorEvents(Body& object)
+	 * @brief	Finds the object under a mouse position. Objects are hit tested here instead of every object
+	 * 			listening to the mouse itself, so the objects do not carry editor-only bindings.
 	 *
-	 * @brief	Unbind editor events
+	 * @author	Julian
+	 * @date	2026-10-19
 	 *
-	 * @author	Wiebe
-	 * @date	29-1-2018
+	 * @param	pos	The mouse position in pixels.
 	 *
-	 * @param [in,out]	object	The physic object subject.
+	 * @return	The last added object under pos, nullptr if there is none.
 	 */
 
-	void unbindEditorEvents(Body& object) {
-		auto it = editorEventConnMap.find(&object);
-
-		if (it != editorEventConnMap.end()) {
-			it->first->unbindMouseEvents();
-			it->second.mouseLeftButtonDown.disconnect();
-			it->second.mouseLeftButtonUp.disconnect();
+	Body* pick(sf::Vector2i pos) {
+		const sf::Vector2f coords = game.renderList->mapPixelToCoords(pos);
 
-			editorEventConnMap.erase(it);
+		for (auto it = map.rbegin(); it != map.rend(); it++) {
+			if ((*it)->getGlobalBounds().contains(coords)) {
+				return it->get();
+			}
 		}
+
+		return nullptr;
 	}
 
 public:
@@ -166,9 +103,9 @@ public:
 
 	Editor(Statemachine& statemachine) :
 		statemachine(statemachine),
-		dock(map, statemachine.window, selection),
+		dock(map, statemachine.renderList, selection),
 		mapFileGenerator(fileOut),
-		camera(statemachine.window, 275),
+		camera(statemachine.renderList, 275),
 		selection(map)
 	{
 		using Type = MapFactory::Type;
@@ -198,6 +135,7 @@ public:
 
 		// Build the map.
 		map = mapFactory.buildMap();
+		map.setChunkCaching(true);
 
 		// Load the textures.
 		std::map<std::string, sf::Texture>& textures = AssetManager::instance()->getTextures();
@@ -229,17 +167,17 @@ public:
 	void entry() override {
 		camera.connect();
 
-		// Bind events for each Body instance.
-		for (const std::unique_ptr<Body>& physicsObject : map) {
-			bindEditorEvents(*physicsObject);
-		}
-
-		objectAddedConn = map.objectAdded.connect([this](Body& physicsObject) {
-			bindEditorEvents(physicsObject);
+		// Picking has to run before the selection handles the same click.
+		mouseLeftButtonDownConn = game.mouse.mouseLeftButtonDown.connect([this](sf::Vector2i pos) {
+			if (Body* object = pick(pos)) {
+				selection.select(object);
+			}
 		});
 
-		objectRemovedConn = map.objectRemoving.connect([this](Body& physicsObject) {
-			unbindEditorEvents(physicsObject);
+		mouseLeftButtonUpConn = game.mouse.mouseLeftButtonUp.connect([this](sf::Vector2i pos) {
+			if (pick(pos) != nullptr) {
+				selection.stopDrag();
+			}
 		});
 
 		keyPressedConnection = game.keyboard.keyPressed.connect([this](sf::Keyboard::Key key) {
@@ -277,13 +215,8 @@ public:
 
 		selection.disconnect();
 
-		objectAddedConn.disconnect();
-		objectRemovedConn.disconnect();
-
-		// Unbind all events for each Body.
-		for (const std::unique_ptr<Body>& physicsObject : map) {
-			unbindEditorEvents(*physicsObject);
-		}
+		mouseLeftButtonDownConn.disconnect();
+		mouseLeftButtonUpConn.disconnect();
 
 		keyReleasedConnection.disconnect();
 
@@ -306,16 +239,17 @@ public:
 		camera.update(elapsedTime);
 
 		map.resolve();
-		map.draw(statemachine.window);
+		map.flushRemovals();
+		map.draw(statemachine.renderList);
 		dock.draw();
 
 		selection.update(elapsedTime);
-		statemachine.window.draw(selection);
+		statemachine.renderList.draw(selection);
 
 		// Draw mouse pointer.
 		sf::RectangleShape rectShape;
 		rectShape.setSize({ 10, 10 });
-		rectShape.setPosition(game.window->mapPixelToCoords(sf::Mouse::getPosition(*game.window)));
-		statemachine.window.draw(rectShape);
+		rectShape.setPosition(game.renderList->mapPixelToCoords(sf::Mouse::getPosition(*game.window)));
+		statemachine.renderList.draw(rectShape);
 	}
 };
\ No newline at end of file
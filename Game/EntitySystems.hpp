@@ -0,0 +1,124 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "EntityWorld.hpp"
+#include "StaticGeometry.hpp"
+#include "Collidable.hpp"
+#include "Collision.hpp"
+
+/**
+ * @class	SpriteSystem
+ *
+ * @brief	Turns entities with a SpriteComponent into rectangles over their AABBComponent.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class SpriteSystem {
+	/**
+	 * @fn	static sf::FloatRect SpriteSystem::getTextureRect(const SpriteComponent& sprite)
+	 *
+	 * @brief	Gets the area of the texture a sprite shows
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	sprite	The sprite.
+	 *
+	 * @return	The area in texels, the whole texture if the sprite has no texture rect.
+	 */
+
+	static sf::FloatRect getTextureRect(const SpriteComponent& sprite) {
+		sf::FloatRect rect(sprite.textureRect);
+
+		if (sprite.texture != nullptr && (rect.width == 0 || rect.height == 0)) {
+			rect = sf::FloatRect(0, 0, static_cast<float>(sprite.texture->getSize().x), static_cast<float>(sprite.texture->getSize().y));
+		}
+
+		return rect;
+	}
+
+public:
+
+	/**
+	 * @fn	static void SpriteSystem::bake(EntityWorld& world, StaticGeometry& geometry)
+	 *
+	 * @brief	Adds the sprites of the entities without a VelocityComponent to geometry, which batches them into its level layer.
+	 * 			The sprites are copied, changing them afterwards has no effect.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	world   	The world.
+	 * @param [in,out]	geometry	The static geometry.
+	 */
+
+	static void bake(EntityWorld& world, StaticGeometry& geometry) {
+		world.eachArchetype<TransformComponent, AABBComponent, SpriteComponent>([&](EntityWorld::Archetype& archetype) {
+			if (archetype.getMask() & ComponentTraits<VelocityComponent>::bit) {
+				return;
+			}
+
+			const std::vector<TransformComponent>& transforms = archetype.column<TransformComponent>();
+			const std::vector<AABBComponent>& boxes = archetype.column<AABBComponent>();
+			const std::vector<SpriteComponent>& sprites = archetype.column<SpriteComponent>();
+
+			for (std::size_t i = 0; i < archetype.size(); i++) {
+				const sf::FloatRect rect(transforms[i].position - boxes[i].halfSize, boxes[i].halfSize * 2.0f);
+				geometry.addQuad(rect, sprites[i].texture, getTextureRect(sprites[i]), sprites[i].color);
+			}
+		});
+	}
+};
+
+/**
+ * @class	CollisionSystem
+ *
+ * @brief	Resolves collisions between a collidable and the solid entities.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class CollisionSystem {
+public:
+
+	/**
+	 * @fn	static void CollisionSystem::resolve(EntityWorld& world, Collidable& collidable)
+	 *
+	 * @brief	Pushes collidable out of every solid entity it intersects, one entity at a time in row order,
+	 * 			the same way a CollisionGroup resolves its collidables. Triggers are never solid.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	world	  	The world.
+	 * @param [in,out]	collidable	The collidable, for instance the player.
+	 */
+
+	static void resolve(EntityWorld& world, Collidable& collidable) {
+		world.eachArchetype<TransformComponent, AABBComponent>([&](EntityWorld::Archetype& archetype) {
+			if (archetype.getMask() & ComponentTraits<TriggerComponent>::bit) {
+				return;
+			}
+
+			const std::vector<TransformComponent>& transforms = archetype.column<TransformComponent>();
+			const std::vector<AABBComponent>& boxes = archetype.column<AABBComponent>();
+
+			for (std::size_t i = 0; i < archetype.size(); i++) {
+				if (!boxes[i].solid) {
+					continue;
+				}
+
+				// The collidable moves while resolving, so every entity is tested against its current position.
+				Collision collision(collidable, transforms[i].position, boxes[i].halfSize);
+
+				if (collision.intersects()) {
+					collidable.resolveCollision(collision);
+				}
+			}
+		});
+	}
+};
@@ -0,0 +1,673 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <memory>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "Components.hpp"
+
+/**
+ * @struct	Entity
+ *
+ * @brief	Handle of an entity in an EntityWorld. A handle of a destroyed entity stays invalid when its slot is reused.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct Entity {
+	/** @brief	Slot of the entity */
+	uint32_t index;
+
+	/** @brief	Incremented every time the slot is reused */
+	uint32_t generation;
+
+	/**
+	 * @fn	bool Entity::operator==(const Entity& rhs) const
+	 *
+	 * @brief	Equality operator
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The right hand side.
+	 *
+	 * @return	True if both refer to the same entity.
+	 */
+
+	bool operator==(const Entity& rhs) const {
+		return index == rhs.index && generation == rhs.generation;
+	}
+};
+
+/**
+ * @class	EntityWorld
+ *
+ * @brief	Stores entities grouped by the set of components they have.
+ *
+ * @detailed Every distinct set of components is an archetype. An archetype stores the components of its entities
+ * 			 in one packed array per component type, so a system that needs a few components walks a few contiguous arrays
+ * 			 and never touches entities that lack one of them. Adding or removing a component moves the entity to
+ * 			 another archetype; removing an entity from an archetype moves its last entity into the gap.
+ * 			 Components are referred to by reference only until the next structural change of the world.
+ * 			 @code{.cpp}
+ * 			   Entity block = world.create();
+ * 			   world.add(block, TransformComponent{ { 100, 200 } });
+ * 			   world.add(block, VelocityComponent{ { 50, 0 }, { 0, 0 } });
+ * 			   world.each<TransformComponent, VelocityComponent>([&](Entity, TransformComponent& transform, VelocityComponent& velocity) {
+ * 			       transform.position += velocity.velocity * elapsedTime;
+ * 			   });
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class EntityWorld {
+public:
+
+	/**
+	 * @class	Archetype
+	 *
+	 * @brief	The entities that have exactly the same components, stored in packed arrays.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	class Archetype {
+		friend class EntityWorld;
+
+		/** @brief	The components of the archetype, ComponentTraits bits */
+		uint32_t mask;
+
+		/** @brief	The entities, in row order */
+		std::vector<Entity> entities;
+
+		/** @brief	An array per component type, only the arrays in mask are used */
+		std::tuple<
+			std::vector<TransformComponent>,
+			std::vector<VelocityComponent>,
+			std::vector<AABBComponent>,
+			std::vector<SpriteComponent>,
+			std::vector<ClickableComponent>,
+			std::vector<TriggerComponent>,
+			std::vector<SerializableComponent>
+		> columns;
+
+		/**
+		 * @fn	template<class F> void Archetype::forEachColumn(F func)
+		 *
+		 * @brief	Calls func with every array that is in mask
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @tparam	F	Callable with any std::vector of a component type.
+		 * @param	func	The function.
+		 */
+
+		template<class F>
+		void forEachColumn(F func) {
+			visit<TransformComponent>(func);
+			visit<VelocityComponent>(func);
+			visit<AABBComponent>(func);
+			visit<SpriteComponent>(func);
+			visit<ClickableComponent>(func);
+			visit<TriggerComponent>(func);
+			visit<SerializableComponent>(func);
+		}
+
+		/**
+		 * @fn	template<class T, class F> void Archetype::visit(F& func)
+		 *
+		 * @brief	Calls func with the array of T, if T is in mask
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @tparam	T	The component type.
+		 * @tparam	F	The function type.
+		 * @param [in,out]	func	The function.
+		 */
+
+		template<class T, class F>
+		void visit(F& func) {
+			if (mask & ComponentTraits<T>::bit) {
+				func(column<T>());
+			}
+		}
+
+		/**
+		 * @fn	std::size_t Archetype::addRow(Entity entity)
+		 *
+		 * @brief	Appends a row with default constructed components
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	entity	The entity of the row.
+		 *
+		 * @return	The row.
+		 */
+
+		std::size_t addRow(Entity entity) {
+			entities.push_back(entity);
+
+			forEachColumn([](auto& column) {
+				column.emplace_back();
+			});
+
+			return entities.size() - 1;
+		}
+
+		/**
+		 * @fn	void Archetype::removeRow(std::size_t row)
+		 *
+		 * @brief	Removes a row by moving the last row into it
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	row	The row.
+		 */
+
+		void removeRow(std::size_t row) {
+			entities[row] = entities.back();
+			entities.pop_back();
+
+			forEachColumn([row](auto& column) {
+				column[row] = std::move(column.back());
+				column.pop_back();
+			});
+		}
+
+	public:
+
+		/**
+		 * @fn	explicit Archetype::Archetype(uint32_t mask)
+		 *
+		 * @brief	Constructor
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	mask	The components of the archetype.
+		 */
+
+		explicit Archetype(uint32_t mask) : mask(mask) { }
+
+		/**
+		 * @fn	uint32_t Archetype::getMask() const
+		 *
+		 * @brief	Gets the components of the archetype
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The ComponentTraits bits.
+		 */
+
+		uint32_t getMask() const {
+			return mask;
+		}
+
+		/**
+		 * @fn	std::size_t Archetype::size() const
+		 *
+		 * @brief	Gets the amount of entities
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The amount of entities.
+		 */
+
+		std::size_t size() const {
+			return entities.size();
+		}
+
+		/**
+		 * @fn	const std::vector<Entity>& Archetype::getEntities() const
+		 *
+		 * @brief	Gets the entities, in the same order as the component arrays
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The entities.
+		 */
+
+		const std::vector<Entity>& getEntities() const {
+			return entities;
+		}
+
+		/**
+		 * @fn	template<class T> std::vector<T>& Archetype::column()
+		 *
+		 * @brief	Gets the packed array of a component type, empty if T is not in the archetype
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @tparam	T	The component type.
+		 *
+		 * @return	The array.
+		 */
+
+		template<class T>
+		std::vector<T>& column() {
+			return std::get<std::vector<T>>(columns);
+		}
+	};
+
+private:
+
+	/**
+	 * @struct	Record
+	 *
+	 * @brief	Where the components of an entity are stored.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Record {
+		/** @brief	The archetype, nullptr if the slot is free */
+		Archetype* archetype;
+
+		/** @brief	Row in the archetype */
+		std::size_t row;
+
+		/** @brief	Generation of the entity in the slot */
+		uint32_t generation;
+	};
+
+	/** @brief	Record per entity slot */
+	std::vector<Record> records;
+
+	/** @brief	Free entity slots */
+	std::vector<uint32_t> freeIndices;
+
+	/** @brief	The archetypes, in order of creation */
+	std::vector<std::unique_ptr<Archetype>> archetypes;
+
+	/** @brief	Amount of live entities */
+	std::size_t count = 0;
+
+	/**
+	 * @fn	Archetype& EntityWorld::getArchetype(uint32_t mask)
+	 *
+	 * @brief	Gets the archetype with exactly the components in mask, creating it if needed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	mask	The mask.
+	 *
+	 * @return	The archetype.
+	 */
+
+	Archetype& getArchetype(uint32_t mask) {
+		for (const std::unique_ptr<Archetype>& archetype : archetypes) {
+			if (archetype->mask == mask) {
+				return *archetype;
+			}
+		}
+
+		archetypes.emplace_back(new Archetype(mask));
+		return *archetypes.back();
+	}
+
+	/**
+	 * @fn	void EntityWorld::removeFromArchetype(const Record& record)
+	 *
+	 * @brief	Removes the row of an entity, updating the record of the entity that is moved into it
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	record	The record of the entity.
+	 */
+
+	void removeFromArchetype(const Record& record) {
+		Archetype& archetype = *record.archetype;
+		const std::size_t row = record.row;
+
+		archetype.removeRow(row);
+
+		if (row < archetype.size()) {
+			records[archetype.entities[row].index].row = row;
+		}
+	}
+
+	/**
+	 * @fn	void EntityWorld::moveTo(Entity entity, uint32_t mask)
+	 *
+	 * @brief	Moves an entity to the archetype of mask, keeping the components both archetypes have
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	entity	The entity.
+	 * @param	mask  	The new set of components.
+	 */
+
+	void moveTo(Entity entity, uint32_t mask) {
+		Record& record = records[entity.index];
+		Archetype& from = *record.archetype;
+		Archetype& to = getArchetype(mask);
+
+		const std::size_t row = to.addRow(entity);
+		const std::size_t oldRow = record.row;
+
+		to.forEachColumn([&from, row, oldRow](auto& column) {
+			using T = typename std::decay_t<decltype(column)>::value_type;
+
+			if (from.mask & ComponentTraits<T>::bit) {
+				column[row] = std::move(from.column<T>()[oldRow]);
+			}
+		});
+
+		const Record old = record;
+		removeFromArchetype(old);
+
+		records[entity.index].archetype = &to;
+		records[entity.index].row = row;
+	}
+
+public:
+
+	/**
+	 * @fn	EntityWorld::EntityWorld()
+	 *
+	 * @brief	Constructs an empty world
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	EntityWorld() = default;
+
+	EntityWorld(const EntityWorld&) = delete;
+	EntityWorld& operator=(const EntityWorld&) = delete;
+
+	EntityWorld(EntityWorld&&) = default;
+	EntityWorld& operator=(EntityWorld&&) = default;
+
+	/**
+	 * @fn	template<class... Ts> static uint32_t EntityWorld::maskOf()
+	 *
+	 * @brief	Computes the mask of a set of component types
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	Ts	The component types.
+	 *
+	 * @return	The mask.
+	 */
+
+	template<class... Ts>
+	static uint32_t maskOf() {
+		uint32_t mask = 0;
+
+		for (uint32_t bit : std::initializer_list<uint32_t>{ 0, ComponentTraits<Ts>::bit... }) {
+			mask |= bit;
+		}
+
+		return mask;
+	}
+
+	/**
+	 * @fn	Entity EntityWorld::create(uint32_t mask = 0)
+	 *
+	 * @brief	Creates an entity with default constructed components, placing it in its final archetype right away
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	mask	(Optional) The components, see EntityWorld::maskOf().
+	 *
+	 * @return	The entity.
+	 */
+
+	Entity create(uint32_t mask = 0) {
+		uint32_t index;
+
+		if (freeIndices.size() > 0) {
+			index = freeIndices.back();
+			freeIndices.pop_back();
+		}
+		else {
+			index = static_cast<uint32_t>(records.size());
+			records.push_back({ nullptr, 0, 0 });
+		}
+
+		Entity entity = { index, records[index].generation };
+		Archetype& archetype = getArchetype(mask);
+
+		records[index].archetype = &archetype;
+		records[index].row = archetype.addRow(entity);
+		count++;
+
+		return entity;
+	}
+
+	/**
+	 * @fn	void EntityWorld::destroy(Entity entity)
+	 *
+	 * @brief	Destroys an entity and its components, does nothing if it has already been destroyed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	entity	The entity.
+	 */
+
+	void destroy(Entity entity) {
+		if (!isAlive(entity)) {
+			return;
+		}
+
+		Record& record = records[entity.index];
+		const Record old = record;
+
+		removeFromArchetype(old);
+
+		record.archetype = nullptr;
+		record.generation++;
+		freeIndices.push_back(entity.index);
+		count--;
+	}
+
+	/**
+	 * @fn	bool EntityWorld::isAlive(Entity entity) const
+	 *
+	 * @brief	Query if entity refers to an entity that has not been destroyed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	entity	The entity.
+	 *
+	 * @return	True if alive.
+	 */
+
+	bool isAlive(Entity entity) const {
+		return entity.index < records.size() && records[entity.index].archetype != nullptr && records[entity.index].generation == entity.generation;
+	}
+
+	/**
+	 * @fn	template<class T> T& EntityWorld::add(Entity entity, T component = T())
+	 *
+	 * @brief	Adds a component to an entity, or replaces the component it already has
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	The component type.
+	 * @param	entity   	The entity, must be alive.
+	 * @param	component	(Optional) The component.
+	 *
+	 * @return	The stored component, valid until the next structural change.
+	 */
+
+	template<class T>
+	T& add(Entity entity, T component = T()) {
+		const uint32_t mask = records[entity.index].archetype->mask;
+
+		if (!(mask & ComponentTraits<T>::bit)) {
+			moveTo(entity, mask | ComponentTraits<T>::bit);
+		}
+
+		const Record& record = records[entity.index];
+		T& stored = record.archetype->column<T>()[record.row];
+		stored = std::move(component);
+
+		return stored;
+	}
+
+	/**
+	 * @fn	template<class T> void EntityWorld::remove(Entity entity)
+	 *
+	 * @brief	Removes a component from an entity, does nothing if it does not have one
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	The component type.
+	 * @param	entity	The entity, must be alive.
+	 */
+
+	template<class T>
+	void remove(Entity entity) {
+		const uint32_t mask = records[entity.index].archetype->mask;
+
+		if (mask & ComponentTraits<T>::bit) {
+			moveTo(entity, mask & ~ComponentTraits<T>::bit);
+		}
+	}
+
+	/**
+	 * @fn	template<class T> T* EntityWorld::get(Entity entity)
+	 *
+	 * @brief	Gets a component of an entity
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	The component type.
+	 * @param	entity	The entity.
+	 *
+	 * @return	The component, nullptr if the entity is not alive or does not have one. Valid until the next structural change.
+	 */
+
+	template<class T>
+	T* get(Entity entity) {
+		if (!isAlive(entity)) {
+			return nullptr;
+		}
+
+		const Record& record = records[entity.index];
+
+		if (!(record.archetype->mask & ComponentTraits<T>::bit)) {
+			return nullptr;
+		}
+
+		return &record.archetype->column<T>()[record.row];
+	}
+
+	/**
+	 * @fn	template<class... Ts, class F> void EntityWorld::each(F func)
+	 *
+	 * @brief	Calls func for every entity that has all of Ts, archetype by archetype.
+	 * 			func may change the components, but may not add or remove entities or components.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	Ts	The required component types.
+	 * @tparam	F 	Callable as void(Entity, Ts&...).
+	 * @param	func	The function.
+	 */
+
+	template<class... Ts, class F>
+	void each(F func) {
+		const uint32_t mask = maskOf<Ts...>();
+
+		for (const std::unique_ptr<Archetype>& archetype : archetypes) {
+			if ((archetype->mask & mask) != mask) {
+				continue;
+			}
+
+			for (std::size_t row = 0; row < archetype->size(); row++) {
+				func(archetype->entities[row], archetype->template column<Ts>()[row]...);
+			}
+		}
+	}
+
+	/**
+	 * @fn	template<class... Ts, class F> void EntityWorld::eachArchetype(F func)
+	 *
+	 * @brief	Calls func for every non-empty archetype that has all of Ts, for systems that walk the packed arrays themselves
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	Ts	The required component types.
+	 * @tparam	F 	Callable as void(Archetype&).
+	 * @param	func	The function.
+	 */
+
+	template<class... Ts, class F>
+	void eachArchetype(F func) {
+		const uint32_t mask = maskOf<Ts...>();
+
+		for (const std::unique_ptr<Archetype>& archetype : archetypes) {
+			if ((archetype->mask & mask) == mask && archetype->size() > 0) {
+				func(*archetype);
+			}
+		}
+	}
+
+	/**
+	 * @fn	std::size_t EntityWorld::size() const
+	 *
+	 * @brief	Gets the amount of live entities
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The amount of entities.
+	 */
+
+	std::size_t size() const {
+		return count;
+	}
+
+	/**
+	 * @fn	void EntityWorld::clear()
+	 *
+	 * @brief	Destroys every entity, handles of them stay invalid
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		for (uint32_t index = 0; index < records.size(); index++) {
+			if (records[index].archetype != nullptr) {
+				records[index].archetype = nullptr;
+				records[index].generation++;
+				freeIndices.push_back(index);
+			}
+		}
+
+		archetypes.clear();
+		count = 0;
+	}
+};
@@ -3,6 +3,8 @@
 #include <functional>
 #include <vector>
 #include <deque>
+#include <memory>
+#include <algorithm>
 
 #include "EventConnection.hpp"
 #include "EventDisconnectable.hpp"
@@ -136,8 +138,25 @@ private:
 		}
 	};
 
-	std::vector<EventBinding> boundFunctions;
-	std::deque<EventBinding> queuedFunctions;
+	/**
+	 * @struct	Bindings
+	 *
+	 * @brief	The functions connected to the source.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Bindings {
+		/** @brief	The functions that are called when the source fires */
+		std::vector<EventBinding> boundFunctions;
+
+		/** @brief	The functions connected while firing, bound at the next fire */
+		std::deque<EventBinding> queuedFunctions;
+	};
+
+	/** @brief	Allocated on the first connect, most sources of map objects are never connected to */
+	std::unique_ptr<Bindings> bindings;
 
 	/**
 	 * @fn	void EventSource::disconnect(EventConnection<Args...>& conn)
@@ -173,21 +192,26 @@ protected:
 		/** @brief	True if disconnected */
 		bool disconnected = false;
 
-		{
-			auto it = std::find(boundFunctions.begin(), boundFunctions.end(), conn);
+		if (bindings) {
+			std::vector<EventBinding>& boundFunctions = bindings->boundFunctions;
+			std::deque<EventBinding>& queuedFunctions = bindings->queuedFunctions;
 
-			if (it != boundFunctions.end()) {
-				boundFunctions.erase(it);
-				disconnected = true;
+			{
+				auto it = std::find(boundFunctions.begin(), boundFunctions.end(), conn);
+
+				if (it != boundFunctions.end()) {
+					boundFunctions.erase(it);
+					disconnected = true;
+				}
 			}
-		}
 
-		{
-			auto it = std::find(queuedFunctions.begin(), queuedFunctions.end(), conn);
+			{
+				auto it = std::find(queuedFunctions.begin(), queuedFunctions.end(), conn);
 
-			if (it != queuedFunctions.end()) {
-				queuedFunctions.erase(it);
-				disconnected = true;
+				if (it != queuedFunctions.end()) {
+					queuedFunctions.erase(it);
+					disconnected = true;
+				}
 			}
 		}
 
@@ -198,6 +222,56 @@ protected:
 
 public:
 
+	/**
+	 * @fn	EventSource::EventSource()
+	 *
+	 * @brief	Default constructor, nothing is allocated until the first connect
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	EventSource() { }
+
+	/**
+	 * @fn	EventSource::EventSource(const EventSource& rhs)
+	 *
+	 * @brief	Copy constructor, copies the connected functions
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The source to copy.
+	 */
+
+	EventSource(const EventSource& rhs) : idCounter(rhs.idCounter) {
+		if (rhs.bindings) {
+			bindings = std::make_unique<Bindings>(*rhs.bindings);
+		}
+	}
+
+	/**
+	 * @fn	EventSource& EventSource::operator=(const EventSource& rhs)
+	 *
+	 * @brief	Assignment operator, copies the connected functions
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The source to copy.
+	 *
+	 * @return	A reference to this object.
+	 */
+
+	EventSource& operator=(const EventSource& rhs) {
+		if (this != &rhs) {
+			idCounter = rhs.idCounter;
+			bindings = rhs.bindings ? std::make_unique<Bindings>(*rhs.bindings) : nullptr;
+		}
+
+		return *this;
+	}
+
 	/**
 	 * @fn	EventConnection<Args...> EventSource::connect(EventFunction func)
 	 *
@@ -225,6 +299,13 @@ public:
 	 */
 
 	EventConnection connect(EventFunction func) {
+		if (!bindings) {
+			bindings = std::make_unique<Bindings>();
+		}
+
+		std::vector<EventBinding>& boundFunctions = bindings->boundFunctions;
+		std::deque<EventBinding>& queuedFunctions = bindings->queuedFunctions;
+
 		if (!locked) {
 			boundFunctions.emplace_back(func, idCounter++);
 			return EventConnection(boundFunctions.back().id, *this);
@@ -251,6 +332,13 @@ public:
 	 */
 
 	void fire(Args... args) {
+		if (!bindings) {
+			return;
+		}
+
+		std::vector<EventBinding>& boundFunctions = bindings->boundFunctions;
+		std::deque<EventBinding>& queuedFunctions = bindings->queuedFunctions;
+
 		LockGuard lockGuard (
 			[&]() { locked = true; },
 			[&]() { locked = false; }
@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 
 #include "Events.hpp"
+#include "RenderList.hpp"
 
 /**
  * @class	FreeCamera
@@ -12,8 +13,8 @@
  * Freely moving camera. Reads inputs from game.keyboard and places the view anywhere on the game.
  * Usage:
  * @code
- * RenderWindow myRenderWindow = getSomeRenderWindow();
- * FreeCamera myCamera(myRenderWindow, 100); // constructs a free camera for myRenderWindow with speed = 100
+ * RenderList& myRenderList = statemachine.renderList;
+ * FreeCamera myCamera(myRenderList, 100); // constructs a free camera for myRenderList with speed = 100
  * myCamera.connect(); // tell FreeCamera to start listening for key events
  * 
  * while (running) { // game loop
@@ -22,7 +23,7 @@
  * }
  * 
  * myCamera.disconnect(); // tell FreeCamera to stop listening for key events
- * myCamera.reset(); // reset the view of myRenderWindow to the original state
+ * myCamera.reset(); // reset the view of myRenderList to the original state
  * @endcode
  *
  * @author	Julian
@@ -32,8 +33,8 @@
 class FreeCamera {
 	/** @brief	The view */
 	sf::View view;
-	/** @brief	The window */
-	sf::RenderWindow& window;
+	/** @brief	The render list the view is applied to */
+	RenderList& window;
 
 	/** @brief	The speed */
 	float speed;
@@ -50,7 +51,7 @@ class FreeCamera {
 public:
 
 	/**
-	 * @fn	FreeCamera::FreeCamera(sf::RenderWindow& window) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window)
+	 * @fn	FreeCamera::FreeCamera(RenderList& window) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window)
 	 *
 	 * @brief	Constructor
 	 * 
@@ -59,13 +60,13 @@ public:
 	 * @author	Julian
 	 * @date	2018-01-30
 	 *
-	 * @param [in,out]	window	The window.
+	 * @param [in,out]	window	The render list.
 	 */
 
-	FreeCamera(sf::RenderWindow& window) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window) { }
+	FreeCamera(RenderList& window) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window) { }
 
 	/**
-	 * @fn	FreeCamera::FreeCamera(sf::RenderWindow& window, float cameraSpeed) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window), speed(cameraSpeed)
+	 * @fn	FreeCamera::FreeCamera(RenderList& window, float cameraSpeed) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window), speed(cameraSpeed)
 	 *
 	 * @brief	Constructor
 	 * 
@@ -75,11 +76,11 @@ public:
 	 * @author	Julian
 	 * @date	2018-01-30
 	 *
-	 * @param [in,out]	window	   	The window.
+	 * @param [in,out]	window	   	The render list.
 	 * @param 		  	cameraSpeed	The camera speed.
 	 */
 
-	FreeCamera(sf::RenderWindow& window, float cameraSpeed) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window), speed(cameraSpeed) { }
+	FreeCamera(RenderList& window, float cameraSpeed) : view(sf::Vector2f(), static_cast<sf::Vector2f>(window.getSize())), window(window), speed(cameraSpeed) { }
 
 	/**
 	 * @fn	void FreeCamera::connect()
@@ -5,9 +5,11 @@
 #include "SFMLEventDecoder.hpp"
 #include "EventSource.hpp"
 #include "AssetManager.hpp"
+#include "RenderList.hpp"
 
 #include "Keyboard.hpp"
 #include "Mouse.hpp"
+#include "InputSampler.hpp"
 
 /**
  * @class	Game
@@ -31,24 +33,32 @@ public:
 	 * @date	1/31/2018
 	 */
 
-	Game() { }
+	Game() : window(nullptr), renderList(nullptr), input(nullptr) { }
 
 	/**
-	 * @fn	Game::Game(sf::RenderWindow& window)
+	 * @fn	Game::Game(sf::RenderWindow& window, RenderList& renderList, InputSampler& input)
 	 *
 	 * @brief	Constructor
 	 *
 	 * @author	Jeffrey
 	 * @date	1/31/2018
 	 *
-	 * @param [in,out]	window	The window.
+	 * @param [in,out]	window	  	The window.
+	 * @param [in,out]	renderList	The render list the states draw into.
+	 * @param [in,out]	input	  	Samples the keys the simulation reads.
 	 */
 
-	Game(sf::RenderWindow& window) : window(&window), keyboard(window), mouse(window){ }
+	Game(sf::RenderWindow& window, RenderList& renderList, InputSampler& input) : window(&window), renderList(&renderList), input(&input), keyboard(window), mouse(window){ }
 
-	/** @brief	The window */
+	/** @brief	The window, only to be used for input since the frames may be rendered on a RenderThread */
 	sf::RenderWindow* window;
 
+	/** @brief	The render list the states draw into, holds the view used for mapping between pixels and coordinates */
+	RenderList* renderList;
+
+	/** @brief	Samples the keys the simulation reads, see KeyScheme::sample() */
+	InputSampler* input;
+
 	/** @brief	Died event, meant to be fired when the player dies. */
 	EventSource<> died;
 
@@ -79,5 +89,5 @@ public:
 
 };
 
-/** @brief	Global game instance, HAS TO BE ASSIGNED IN MAIN() USING @code Game game = Game(window); @endcode */
+/** @brief	Global game instance, HAS TO BE ASSIGNED IN MAIN() USING @code Game game = Game(window, statemachine.renderList, input); @endcode */
 static Game game;
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Statemachine.hpp"
 #include "Characters.hpp"
 #include "Button.hpp"
+#include "UiLayer.hpp"
 #include <SFML/Audio.hpp>
 
 /**
@@ -57,6 +58,9 @@ class GameOver : public State {
 	/** @brief  The main-menubutton mouse leave connection */
 	EventConnection mainMenuMouseLeaveConn;
 
+	/** @brief	Retained composition of the widgets */
+	UiLayer ui;
+
 public:
 
 	/**
@@ -99,6 +103,11 @@ public:
         exitButton.setCharSize(32);
         exitButton.setBackgroundColor({0,153,51});
         exitButton.setText("Exit game");
+
+		ui.add(menuLabel);
+		ui.add(mainMenuButton);
+		ui.add(restartGameButton);
+		ui.add(exitButton);
 	}
 
 	/**
@@ -122,15 +131,15 @@ public:
         });
 
         mainMenuButtonReleasedConn = mainMenuButton.buttonReleased.connect([this]() {
-			statemachine.resetState("running");
+			statemachine.restartState("running");
             statemachine.doTransition("main-menu");
 		});
         restartGameButtonReleasedConn = restartGameButton.buttonReleased.connect([this]() {
-            statemachine.resetState("running");
+            statemachine.restartState("running");
             statemachine.doTransition("running");
         });
         exitButtonReleasedConn = exitButton.buttonReleased.connect([this]() {
-            statemachine.window.close();
+            statemachine.close();
         }); 
 
 		exitMouseEnterConn = exitButton.mouseEnter.connect([this]() {
@@ -156,6 +165,7 @@ public:
 			mainMenuButton.setBackgroundColor({ 0, 153, 51 });
 		});
 
+		requireAsset("game-over");
 		AssetManager::instance()->getSound("game-over").play();
 	}
 
@@ -186,7 +196,7 @@ public:
 	/**
 	 * @fn	void GameOver::update(const float elapsedTime) override
 	 *
-	 * @brief	Updates the buttons
+	 * @brief	Draws the buttons over the dimmed last frame of the level
 	 *
 	 * @author	Jeffrey de Waal
 	 * @date	1/25/2018
@@ -195,9 +205,22 @@ public:
 	 */
 
 	void update(const float elapsedTime) override {
-		statemachine.window.draw(menuLabel);
-		statemachine.window.draw(mainMenuButton);
-		statemachine.window.draw(restartGameButton);
-		statemachine.window.draw(exitButton);
+		statemachine.drawFrozenFrame(sf::Color(110, 50, 50));
+		ui.draw(statemachine.renderList);
+	}
+
+	/**
+	 * @fn	bool GameOver::needsRedraw() const override
+	 *
+	 * @brief	Only redraws when one of the widgets changed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if the widgets have to be recomposed.
+	 */
+
+	bool needsRedraw() const override {
+		return ui.isDirty();
 	}
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Statemachine.hpp"
 #include "Characters.hpp"
 #include "Button.hpp"
+#include "UiLayer.hpp"
 
 /**
  * @class	GamePauze
@@ -55,6 +56,9 @@ class GamePauze : public State {
 	/** @brief	The key released connection */
 	EventConnection keyReleasedConnection;
 
+	/** @brief	Retained composition of the widgets */
+	UiLayer ui;
+
 public:
 
 	/**
@@ -92,6 +96,9 @@ public:
 		gameExitButton.setBackgroundColor({ 0, 153, 51 });
 		gameExitButton.setText("Exit game");
 
+		ui.add(gameResumeButton);
+		ui.add(gameRestartButton);
+		ui.add(gameExitButton);
 
 	}
 
@@ -111,7 +118,7 @@ public:
         });
 
 		gameRestartButtonReleasedConn = gameRestartButton.buttonReleased.connect([this]() {
-			statemachine.resetState("running");
+			statemachine.restartState("running");
 			statemachine.doTransition("running");
 		});
 
@@ -120,7 +127,7 @@ public:
 		});
 
 		gameExitButtonReleasedConn = gameExitButton.buttonReleased.connect([this]() {
-			statemachine.resetState("running");
+			statemachine.restartState("running");
 			statemachine.doTransition("game-over");
 		});
 
@@ -191,7 +198,7 @@ public:
 	/**
 	 * @fn	void GamePauze::update(const float elapsedTime) override
 	 *
-	 * @brief	Updates the buttons.
+	 * @brief	Draws the buttons over the dimmed last frame of the level.
 	 *
 	 * @author	Jeffrey de Waal
 	 * @date	1/25/2018
@@ -200,8 +207,22 @@ public:
 	 */
 
 	void update(const float elapsedTime) override {
-		statemachine.window.draw(gameResumeButton);
-		statemachine.window.draw(gameRestartButton);
-		statemachine.window.draw(gameExitButton);
+		statemachine.drawFrozenFrame(sf::Color(90, 90, 90));
+		ui.draw(statemachine.renderList);
+	}
+
+	/**
+	 * @fn	bool GamePauze::needsRedraw() const override
+	 *
+	 * @brief	Only redraws when one of the widgets changed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if the widgets have to be recomposed.
+	 */
+
+	bool needsRedraw() const override {
+		return ui.isDirty();
 	}
 };
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @class	ImagePrefetcher
+ *
+ * @brief	Decodes image files on a worker thread.
+ *
+ * @detailed Decoding a large image takes long enough to stall a frame, uploading the decoded pixels is fast.
+ * 			 Paths passed to ImagePrefetcher::request() are decoded in order on the worker thread,
+ * 			 the owner collects the results with ImagePrefetcher::poll() and uploads them on its own thread.
+ * 			 @code{.cpp}
+ * 			   prefetcher.request("cutscene/2.jpg");
+ * 			   // every frame
+ * 			   ImagePrefetcher::Result result;
+ * 			   if (prefetcher.poll(result) && result.loaded) {
+ * 			       AssetManager::instance()->loadTexture(result.path, result.image, result.path);
+ * 			   }
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ImagePrefetcher {
+public:
+
+	/**
+	 * @struct	Result
+	 *
+	 * @brief	A decoded image.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Result {
+		/** @brief	The requested path */
+		std::string path;
+
+		/** @brief	The decoded image, empty if loading failed */
+		sf::Image image;
+
+		/** @brief	False if the file could not be read or decoded */
+		bool loaded = false;
+	};
+
+private:
+	/** @brief	Guards the fields below */
+	std::mutex mutex;
+
+	/** @brief	Signalled when a path is requested or the thread has to stop */
+	std::condition_variable requested;
+
+	/** @brief	Paths that have not been decoded yet, in request order */
+	std::deque<std::string> queue;
+
+	/** @brief	Decoded images that have not been polled yet */
+	std::deque<Result> results;
+
+	/** @brief	False once the thread has to stop */
+	bool running = true;
+
+	/** @brief	The worker thread */
+	std::thread thread;
+
+	/**
+	 * @fn	void ImagePrefetcher::run()
+	 *
+	 * @brief	Decodes requested paths until the thread is stopped
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void run() {
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (true) {
+			requested.wait(lock, [this]() {
+				return !queue.empty() || !running;
+			});
+
+			if (!running) {
+				break;
+			}
+
+			Result result;
+			result.path = queue.front();
+			queue.pop_front();
+
+			lock.unlock();
+			result.loaded = result.image.loadFromFile(result.path);
+			lock.lock();
+
+			results.push_back(std::move(result));
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	ImagePrefetcher::ImagePrefetcher()
+	 *
+	 * @brief	Starts the worker thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	ImagePrefetcher() : thread(&ImagePrefetcher::run, this) { }
+
+	ImagePrefetcher(const ImagePrefetcher&) = delete;
+	ImagePrefetcher& operator=(const ImagePrefetcher&) = delete;
+
+	/**
+	 * @fn	ImagePrefetcher::~ImagePrefetcher()
+	 *
+	 * @brief	Stops the worker thread after the image it is decoding, dropping the other requests
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~ImagePrefetcher() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+
+		requested.notify_all();
+		thread.join();
+	}
+
+	/**
+	 * @fn	void ImagePrefetcher::request(const std::string& path)
+	 *
+	 * @brief	Queues path for decoding
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	path	The image path.
+	 */
+
+	void request(const std::string& path) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(path);
+		}
+
+		requested.notify_all();
+	}
+
+	/**
+	 * @fn	bool ImagePrefetcher::poll(Result& result)
+	 *
+	 * @brief	Takes the oldest decoded image without blocking
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [out]	result	The decoded image.
+	 *
+	 * @return	False if no image has been decoded since the last poll.
+	 */
+
+	bool poll(Result& result) {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (results.empty()) {
+			return false;
+		}
+
+		result = std::move(results.front());
+		results.pop_front();
+		return true;
+	}
+
+	/**
+	 * @fn	void ImagePrefetcher::clear()
+	 *
+	 * @brief	Drops the requests that have not been decoded and the results that have not been polled.
+	 * 			An image that is being decoded is still reported by ImagePrefetcher::poll().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		queue.clear();
+		results.clear();
+	}
+};
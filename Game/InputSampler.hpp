@@ -0,0 +1,448 @@
+#pragma once
+
+#include <SFML/Window.hpp>
+#include <array>
+#include <bitset>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <cstdint>
+
+#include "SpscQueue.hpp"
+
+/**
+ * @struct	InputEvent
+ *
+ * @brief	A key changing state, as seen by the InputSampler.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct InputEvent {
+	/** @brief	The key */
+	sf::Keyboard::Key key;
+
+	/** @brief	True if the key went down, false if it went up */
+	bool pressed;
+
+	/** @brief	Time since the InputSampler started */
+	sf::Time time;
+};
+
+/**
+ * @class	KeyboardState
+ *
+ * @brief	State of the keyboard during a simulation tick, built from the InputEvents collected for it.
+ *
+ * @detailed Besides the keys that are held at the end of the tick, the keys that went down or up during the tick are kept,
+ * 			 so a key that was pressed and released within one tick still counts as down for that tick.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class KeyboardState {
+	/** @brief	Keys that are down */
+	std::bitset<sf::Keyboard::KeyCount> held;
+
+	/** @brief	Keys that went down during the tick */
+	std::bitset<sf::Keyboard::KeyCount> pressed;
+
+	/** @brief	Keys that went up during the tick */
+	std::bitset<sf::Keyboard::KeyCount> released;
+
+	/** @brief	The changes applied during the tick, in order */
+	std::vector<InputEvent> events;
+
+public:
+
+	/**
+	 * @fn	void KeyboardState::beginTick()
+	 *
+	 * @brief	Forgets the edges of the previous tick, held keys stay down
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void beginTick() {
+		pressed.reset();
+		released.reset();
+		events.clear();
+	}
+
+	/**
+	 * @fn	void KeyboardState::apply(const InputEvent& event)
+	 *
+	 * @brief	Applies a change of a key
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	event	The event.
+	 */
+
+	void apply(const InputEvent& event) {
+		events.push_back(event);
+		held[event.key] = event.pressed;
+
+		if (event.pressed) {
+			pressed[event.key] = true;
+		}
+		else {
+			released[event.key] = true;
+		}
+	}
+
+	/**
+	 * @fn	const std::vector<InputEvent>& KeyboardState::getEvents() const
+	 *
+	 * @brief	Gets the changes applied during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The changes, in the order they happened.
+	 */
+
+	const std::vector<InputEvent>& getEvents() const {
+		return events;
+	}
+
+	/**
+	 * @fn	bool KeyboardState::isHeld(sf::Keyboard::Key key) const
+	 *
+	 * @brief	Query if key is down at the end of the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 *
+	 * @return	True if held.
+	 */
+
+	bool isHeld(sf::Keyboard::Key key) const {
+		return key >= 0 && key < sf::Keyboard::KeyCount && held[key];
+	}
+
+	/**
+	 * @fn	bool KeyboardState::isDown(sf::Keyboard::Key key) const
+	 *
+	 * @brief	Query if key is down, or went down at some point during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 *
+	 * @return	True if down.
+	 */
+
+	bool isDown(sf::Keyboard::Key key) const {
+		return key >= 0 && key < sf::Keyboard::KeyCount && (held[key] || pressed[key]);
+	}
+
+	/**
+	 * @fn	bool KeyboardState::wasPressed(sf::Keyboard::Key key) const
+	 *
+	 * @brief	Query if key went down during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 *
+	 * @return	True if pressed.
+	 */
+
+	bool wasPressed(sf::Keyboard::Key key) const {
+		return key >= 0 && key < sf::Keyboard::KeyCount && pressed[key];
+	}
+
+	/**
+	 * @fn	bool KeyboardState::wasReleased(sf::Keyboard::Key key) const
+	 *
+	 * @brief	Query if key went up during the tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 *
+	 * @return	True if released.
+	 */
+
+	bool wasReleased(sf::Keyboard::Key key) const {
+		return key >= 0 && key < sf::Keyboard::KeyCount && released[key];
+	}
+};
+
+/**
+ * @class	InputSampler
+ *
+ * @brief	Samples the keyboard on its own thread and queues every change with a timestamp.
+ *
+ * @detailed Window events are only read once per pass of the main loop, and the simulation only looked at the keys once per tick,
+ * 			 so a press shorter than a tick could be missed. The sampler thread reads the real-time state of the watched keys
+ * 			 every interval and pushes the changes into a lock-free queue. The simulation collects them into a KeyboardState
+ * 			 at the start of every tick, keeping the presses that were released again before the tick.
+ * 			 Keys are only sampled while the window has focus, losing focus releases every held key.
+ * 			 Without focus or without watched keys the thread waits until InputSampler::watch() or
+ * 			 InputSampler::setFocused() wakes it, so it does not wake up every interval on menu screens.
+ * 			 @code{.cpp}
+ * 			   input.watch(sf::Keyboard::Space);
+ * 			   // every simulation tick
+ * 			   input.collect(keyboardState);
+ * 			   if (keyboardState.isDown(sf::Keyboard::Space)) {
+ * 			       player.doJump();
+ * 			   }
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class InputSampler {
+	/** @brief	Per key, the amount of times it is watched */
+	std::array<std::atomic<uint8_t>, sf::Keyboard::KeyCount> watched;
+
+	/** @brief	Amount of watches over all keys */
+	std::atomic<uint32_t> watchCount;
+
+	/** @brief	The changes that have not been collected yet */
+	SpscQueue<InputEvent, 1024> events;
+
+	/** @brief	Time between two samples */
+	sf::Time interval;
+
+	/** @brief	Started when the sampler is constructed, timestamps are relative to it */
+	sf::Clock clock;
+
+	/** @brief	True while the window has focus */
+	std::atomic<bool> focused;
+
+	/** @brief	False once the thread has to stop */
+	std::atomic<bool> running;
+
+	/** @brief	Guards waking the thread, focused, running and the watch counts are changed under it */
+	std::mutex wakeMutex;
+
+	/** @brief	Notified when the thread may have to sample again or stop */
+	std::condition_variable wake;
+
+	/** @brief	The sampler thread */
+	std::thread thread;
+
+	/**
+	 * @fn	void InputSampler::run()
+	 *
+	 * @brief	Samples the watched keys until the thread is stopped, waiting while there is nothing to sample
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void run() {
+		std::bitset<sf::Keyboard::KeyCount> held;
+
+		while (running) {
+			const bool sampling = focused;
+
+			for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+				const sf::Keyboard::Key key = static_cast<sf::Keyboard::Key>(i);
+				const bool down = sampling && watched[i] > 0 && sf::Keyboard::isKeyPressed(key);
+
+				// A change that does not fit in the queue is pushed again on the next sample.
+				if (down != held[i] && events.push({ key, down, clock.getElapsedTime() })) {
+					held[i] = down;
+				}
+			}
+
+			// Once every key has been released there is nothing to sample until a key is watched or focus returns.
+			if ((!sampling || watchCount == 0) && held.none()) {
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				wake.wait(lock, [this]() { return !running || (focused && watchCount > 0); });
+				continue;
+			}
+
+			sf::sleep(interval);
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	InputSampler::InputSampler(sf::Time interval = sf::milliseconds(1))
+	 *
+	 * @brief	Starts the sampler thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	interval	(Optional) Time between two samples.
+	 */
+
+	InputSampler(sf::Time interval = sf::milliseconds(1)) : watchCount(0), interval(interval), focused(true), running(true) {
+		for (std::atomic<uint8_t>& count : watched) {
+			count = 0;
+		}
+
+		thread = std::thread(&InputSampler::run, this);
+	}
+
+	InputSampler(const InputSampler&) = delete;
+	InputSampler& operator=(const InputSampler&) = delete;
+
+	/**
+	 * @fn	InputSampler::~InputSampler()
+	 *
+	 * @brief	Stops the sampler thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~InputSampler() {
+		{
+			std::lock_guard<std::mutex> lock(wakeMutex);
+			running = false;
+		}
+
+		wake.notify_one();
+		thread.join();
+	}
+
+	/**
+	 * @fn	void InputSampler::watch(sf::Keyboard::Key key)
+	 *
+	 * @brief	Starts sampling key, a key watched more than once is sampled until every watch has been removed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 */
+
+	void watch(sf::Keyboard::Key key) {
+		if (key >= 0 && key < sf::Keyboard::KeyCount) {
+			{
+				std::lock_guard<std::mutex> lock(wakeMutex);
+				watched[key]++;
+				watchCount++;
+			}
+
+			wake.notify_one();
+		}
+	}
+
+	/**
+	 * @fn	void InputSampler::unwatch(sf::Keyboard::Key key)
+	 *
+	 * @brief	Removes a watch added with InputSampler::watch()
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 */
+
+	void unwatch(sf::Keyboard::Key key) {
+		std::lock_guard<std::mutex> lock(wakeMutex);
+
+		if (key >= 0 && key < sf::Keyboard::KeyCount && watched[key] > 0) {
+			watched[key]--;
+			watchCount--;
+		}
+	}
+
+	/**
+	 * @fn	void InputSampler::setFocused(bool focused)
+	 *
+	 * @brief	Sets whether the window has focus, keys are not sampled without it and regaining it wakes the thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	focused	True if the window has focus.
+	 */
+
+	void setFocused(bool focused) {
+		{
+			std::lock_guard<std::mutex> lock(wakeMutex);
+			this->focused = focused;
+		}
+
+		if (focused) {
+			wake.notify_one();
+		}
+	}
+
+	/**
+	 * @fn	sf::Time InputSampler::getTime() const
+	 *
+	 * @brief	Gets the current time on the clock of the timestamps
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The time since the sampler started.
+	 */
+
+	sf::Time getTime() const {
+		return clock.getElapsedTime();
+	}
+
+	/**
+	 * @fn	std::size_t InputSampler::collect(KeyboardState& state, sf::Time until)
+	 *
+	 * @brief	Starts a new tick of state and applies the changes sampled up to until, in the order they happened.
+	 * 			Only to be called from one thread.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	state	The keyboard state of the simulation.
+	 * @param 		  	until	End of the tick, later changes are left for the next tick.
+	 *
+	 * @return	The amount of applied changes.
+	 */
+
+	std::size_t collect(KeyboardState& state, sf::Time until) {
+		std::size_t count = 0;
+
+		state.beginTick();
+
+		while (const InputEvent* event = events.front()) {
+			if (event->time > until) {
+				break;
+			}
+
+			state.apply(*event);
+			events.pop();
+			count++;
+		}
+
+		return count;
+	}
+
+	/**
+	 * @fn	std::size_t InputSampler::collect(KeyboardState& state)
+	 *
+	 * @brief	Starts a new tick of state and applies every change sampled so far
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	state	The keyboard state of the simulation.
+	 *
+	 * @return	The amount of applied changes.
+	 */
+
+	std::size_t collect(KeyboardState& state) {
+		return collect(state, getTime());
+	}
+};
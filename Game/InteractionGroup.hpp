@@ -1,5 +1,9 @@
 #pragma once
 
+#include <unordered_set>
+
+class Collidable;
+
 /**
  * @class	InteractionGroup
  *
@@ -22,4 +26,41 @@ public:
 	 */
 
 	virtual void resolve() = 0;
+
+	/**
+	 * @fn	virtual void InteractionGroup::erase(Collidable& collidable) = 0;
+	 *
+	 * @brief	Stops the group from referring to collidable, so it can be destroyed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	collidable	The collidable.
+	 */
+
+	virtual void erase(Collidable& collidable) = 0;
+
+	/**
+	 * @fn	virtual void InteractionGroup::erase(const std::unordered_set<const Collidable*>& collidables) = 0;
+	 *
+	 * @brief	Stops the group from referring to any of the collidables in a single pass, keeping the order of the others
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	collidables	The collidables.
+	 */
+
+	virtual void erase(const std::unordered_set<const Collidable*>& collidables) = 0;
+
+	/**
+	 * @fn	virtual InteractionGroup::~InteractionGroup()
+	 *
+	 * @brief	Destructor, groups are owned through a pointer to this class
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	virtual ~InteractionGroup() { }
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 
 #include "Collidable.hpp"
 
@@ -61,9 +62,9 @@ public:
 	}
 
 	/**
-	 * @fn	void IntersectionGroup::erase(Collidable& collidable)
+	 * @fn	void IntersectionGroup::erase(Collidable& collidable) override
 	 *
-	 * @brief	Erases the given collidable
+	 * @brief	Erases the given collidable, the group stops resolving once its primary collidable is erased
 	 *
 	 * @author	Jeffrey
 	 * @date	1/31/2018
@@ -71,7 +72,7 @@ public:
 	 * @param [in,out]	collidable	The collidable.
 	 */
 
-	void erase(Collidable& collidable) {
+	void erase(Collidable& collidable) override {
 		erase(&collidable);
 	}
 
@@ -87,6 +88,10 @@ public:
 	 */
 
 	void erase(Collidable* collidable) {
+		if (primaryCollidable == collidable) {
+			primaryCollidable = nullptr;
+		}
+
 		auto it = std::find(begin(), end(), collidable);
 
 		if (it != end()) {
@@ -94,6 +99,27 @@ public:
 		}
 	}
 
+	/**
+	 * @fn	void IntersectionGroup::erase(const std::unordered_set<const Collidable*>& collidables) override
+	 *
+	 * @brief	Erases the given collidables in a single pass, keeping the order of the others
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	collidables	The collidables.
+	 */
+
+	void erase(const std::unordered_set<const Collidable*>& collidables) override {
+		if (collidables.count(primaryCollidable) != 0) {
+			primaryCollidable = nullptr;
+		}
+
+		std::vector<Collidable*>::erase(std::remove_if(begin(), end(), [&collidables](const Collidable* collidable) {
+			return collidables.count(collidable) != 0;
+		}), end());
+	}
+
 	/**
 	 * @fn	void IntersectionGroup::setPrimary(Collidable& collidable)
 	 *
@@ -134,6 +160,10 @@ public:
 	 */
 
 	void resolve() override {
+		if (primaryCollidable == nullptr) {
+			return;
+		}
+
 		std::for_each(begin(), end(), [this](Collidable* collidable) {
 			if (primaryCollidable->getCollision(*collidable).intersects()) {
 				primaryCollidable->onCollide(*collidable);
@@ -1,6 +1,26 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+
+#include "InputSampler.hpp"
+
+/**
+ * @enum	PlayerAction
+ *
+ * @brief	The actions a KeyScheme binds keys to.
+ */
+
+enum class PlayerAction : uint8_t {
+	MoveLeft,
+	MoveRight,
+	Jump,
+	Roll,
+	Run,
+	Count,
+	None = 0xFF
+};
 
 /**
  * @class	KeySchemeNotFoundException
@@ -40,8 +60,29 @@ public:
  */
 
 class KeyScheme {
-	EventConnection keyPressedConn;
-	EventConnection keyReleasedConn;
+	/** @brief	True while the keys are sampled */
+	bool connected = false;
+
+	/** @brief	The action of every key, PlayerAction::None for unbound keys */
+	std::array<PlayerAction, sf::Keyboard::KeyCount> actionTable;
+
+	/**
+	 * @fn	void KeyScheme::bind(sf::Keyboard::Key key, PlayerAction action)
+	 *
+	 * @brief	Binds key to action in the action table
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key   	The key.
+	 * @param	action	The action.
+	 */
+
+	void bind(sf::Keyboard::Key key, PlayerAction action) {
+		if (key >= 0 && key < sf::Keyboard::KeyCount) {
+			actionTable[key] = action;
+		}
+	}
 
 public:
 	/** @brief	The move left key */
@@ -75,12 +116,6 @@ public:
 	/** @brief	The difficulty */
 	Difficulty difficulty;
 
-	bool moveLeftPressed = false;
-	bool moveRightPressed = false;
-	bool jumpPressed = false;
-	bool rollPressed = false;
-	bool runPressed = false;
-
 	/**
 	 * @fn	KeyScheme::KeyScheme(sf::Keyboard::Key moveLeft, sf::Keyboard::Key moveRight, sf::Keyboard::Key jump, sf::Keyboard::Key roll, sf::Keyboard::Key run, Difficulty difficulty = Difficulty::UNDEFINED)
 	 *
@@ -104,49 +139,73 @@ public:
 		roll(roll),
 		run(run),
 		difficulty(difficulty)
-	{ };
+	{
+		actionTable.fill(PlayerAction::None);
+
+		bind(moveLeft, PlayerAction::MoveLeft);
+		bind(moveRight, PlayerAction::MoveRight);
+		bind(jump, PlayerAction::Jump);
+		bind(roll, PlayerAction::Roll);
+		bind(run, PlayerAction::Run);
+	};
+
+	/**
+	 * @fn	PlayerAction KeyScheme::getAction(sf::Keyboard::Key key) const
+	 *
+	 * @brief	Looks up the action bound to key
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	key	The key.
+	 *
+	 * @return	The action, PlayerAction::None if key is not bound.
+	 */
+
+	PlayerAction getAction(sf::Keyboard::Key key) const {
+		return key >= 0 && key < sf::Keyboard::KeyCount ? actionTable[key] : PlayerAction::None;
+	}
+
+	/**
+	 * @fn	void KeyScheme::connect()
+	 *
+	 * @brief	Starts sampling the keys of the scheme, so an ActionMap can switch to it without missing held keys
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
 
 	void connect() {
-		keyPressedConn = game.keyboard.keyPressed.connect([=](const sf::Keyboard::Key key) {
-			if (key == jump) {
-				jumpPressed = true;
-			}
-			else if (key == roll) {
-				rollPressed = true;
-			}
-			else if (key == run) {
-				runPressed = true;
-			}
-			else if (key == moveLeft) {
-				moveLeftPressed = true;
-			}
-			else if (key == moveRight) {
-				moveRightPressed = true;
-			}
-		});
-
-		keyReleasedConn = game.keyboard.keyReleased.connect([=](const sf::Keyboard::Key key) {
-			if (key == jump) {
-				jumpPressed = false;
-			}
-			else if (key == roll) {
-				rollPressed = false;
-			}
-			else if (key == run) {
-				runPressed = false;
-			}
-			else if (key == moveLeft) {
-				moveLeftPressed = false;
-			}
-			else if (key == moveRight) {
-				moveRightPressed = false;
-			}
-		});
+		if (connected || game.input == nullptr) {
+			return;
+		}
+
+		for (sf::Keyboard::Key key : { moveLeft, moveRight, jump, roll, run }) {
+			game.input->watch(key);
+		}
+
+		connected = true;
 	}
 
+	/**
+	 * @fn	void KeyScheme::disconnect()
+	 *
+	 * @brief	Stops sampling the keys of the scheme
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
 	void disconnect() {
-		keyPressedConn.disconnect();
-		keyReleasedConn.disconnect();
+		if (!connected) {
+			return;
+		}
+
+		for (sf::Keyboard::Key key : { moveLeft, moveRight, jump, roll, run }) {
+			game.input->unwatch(key);
+		}
+
+		connected = false;
 	}
 
    /**
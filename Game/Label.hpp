@@ -1,6 +1,10 @@
 #pragma  once
 
 #include <SFML/Graphics.hpp>
+#include <mutex>
+
+#include "Widget.hpp"
+#include "RenderList.hpp"
 
 /**
  * @class	Label
@@ -11,7 +15,7 @@
  * @date	25-1-2018
  */
 
-class Label : public sf::Drawable {
+class Label : public Widget {
 private:
 
     /** @brief	The font used */
@@ -74,6 +78,7 @@ public:
      * @param font A custom font.
      */
 	void setFont(sf::Font& font) {
+		markDirty();
 		displayText.setFont(font);
 	}
 
@@ -82,6 +87,7 @@ public:
      * @param text A string that will be displayed.
      */
     void setText(const std::string& text){
+        markDirty();
         displayText.setString(text);
     }
 
@@ -98,6 +104,7 @@ public:
      * @param color The color of the text.
      */
     void setColor(sf::Color color){
+        markDirty();
         displayText.setFillColor(color);
     }
 
@@ -106,6 +113,7 @@ public:
      * @param position Vector of the positon..
      */
     void setPosition(sf::Vector2f position){
+        markDirty();
         displayText.setPosition(position);
     }
 
@@ -114,6 +122,7 @@ public:
      * @param size The size of a character.
      */
     void setCharSize(int size){
+        markDirty();
         displayText.setCharacterSize(size);
     }
 
@@ -122,6 +131,7 @@ public:
      * @param position A vector with the  new position of the origin.
      */
     void setOrigin(sf::Vector2f position){
+        markDirty();
         displayText.setOrigin(position);
     }
 
@@ -131,6 +141,7 @@ public:
      * @param y The y coordinate of the new origin.
      */
     void setOrigin(float x, float y){
+        markDirty();
         displayText.setOrigin({x,y});
     }
 
@@ -139,7 +150,16 @@ public:
      * @param window Reference to window the text will be displayed on.
      */
     void draw(sf::RenderTarget &window, sf::RenderStates states) const {
-        window.draw(displayText);
+        std::lock_guard<std::mutex> lock(RenderList::getGlyphMutex());
+        window.draw(displayText, states);
+    }
+
+    /**
+     * @brief Record the text into a render list.
+     * @param renderList The render list the text will be recorded into.
+     */
+    void draw(RenderList &renderList, sf::RenderStates states) const override {
+        renderList.draw(displayText, states);
     }
 
     /**
@@ -147,20 +167,33 @@ public:
      * @return Body of the outer bounds of the text.
      */
     sf::FloatRect getBounds(){
+        std::lock_guard<std::mutex> lock(RenderList::getGlyphMutex());
         return displayText.getLocalBounds();
     }
 
+    /**
+     * @brief Get the area the text is drawn to.
+     * @return The global bounds of the text.
+     */
+    sf::FloatRect getGlobalBounds() const override {
+        std::lock_guard<std::mutex> lock(RenderList::getGlyphMutex());
+        return displayText.getGlobalBounds();
+    }
+
     /**
      * @brief Set the sytle of the text, for example bold or italic..
      * @param style The new style for the text.
      */
     void setStyle(sf::Text::Style style){
+        markDirty();
         displayText.setStyle(style);
     }
     void  setOutlineColor(const sf::Color & color){
+        markDirty();
         displayText.setOutlineColor(color);
     }
     void setOutlineThicknes(float size){
+        markDirty();
         displayText.setOutlineThickness(size);
     }
 };
@@ -4,6 +4,7 @@
 #include "Statemachine.hpp"
 #include "Characters.hpp"
 #include "Button.hpp"
+#include "UiLayer.hpp"
 
 /**
  * @class	MainMenu
@@ -55,6 +56,9 @@ class MainMenu : public State {
 	/** @brief	The mouse leave connection */
 	EventConnection mouseLeaveConn;
 
+	/** @brief	Retained composition of the widgets */
+	UiLayer ui;
+
 public:
 
 	/**
@@ -105,6 +109,12 @@ public:
 		exitButton.setCharSize(32);
 		exitButton.setBackgroundColor({0,153,51});
 		exitButton.setText("Exit game");
+
+		ui.add(menuLabel);
+		ui.add(startButton);
+		ui.add(settingsButton);
+		ui.add(exitButton);
+		ui.add(mapEditorButton);
 	}
 
 	/**
@@ -116,6 +126,8 @@ public:
 	 * @date	1/25/2018
 	 */
 	void entry() override {
+		startButton.setPosition({ 640, 360 });
+
 		startButtonPressedConn = startButton.buttonPressed.connect([this]() {
 			startButton.setBackgroundColor({ 0, 163, 61 });
 		});
@@ -131,7 +143,7 @@ public:
 		});
 
 		startButtonReleasedConn = startButton.buttonReleased.connect([this]() {
-			statemachine.resetState("running");
+			statemachine.restartState("running");
 			statemachine.doTransition("running");
 		});
 
@@ -140,7 +152,7 @@ public:
 
         });
         exitButtonReleasedConn = exitButton.buttonReleased.connect([this]() {
-            statemachine.window.close();
+            statemachine.close();
         });
 		mapEditorButtonReleasedConn = mapEditorButton.buttonReleased.connect([this]() {
 			statemachine.resetState("map-editor");
@@ -198,7 +210,7 @@ public:
 	/**
 	 * @fn	void update(const float elapsedTime) override
 	 *
-	 * @brief	Updates the buttons and the fimmy text.
+	 * @brief	Draws the buttons and the fimmy text, recomposing only the ones that changed.
 	 *
 	 * @author	Jeffrey de Waal
 	 * @date	1/25/2018
@@ -207,11 +219,21 @@ public:
 	 */
 
 	void update(const float elapsedTime) override {
-		startButton.setPosition({ 640, 360 });
-		statemachine.window.draw(menuLabel);
-		statemachine.window.draw(startButton);
-		statemachine.window.draw(settingsButton);
-		statemachine.window.draw(exitButton);
-		statemachine.window.draw(mapEditorButton);
+		ui.draw(statemachine.renderList);
+	}
+
+	/**
+	 * @fn	bool MainMenu::needsRedraw() const override
+	 *
+	 * @brief	Only redraws when one of the widgets changed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if the widgets have to be recomposed.
+	 */
+
+	bool needsRedraw() const override {
+		return ui.isDirty();
 	}
 };
\ No newline at end of file
@@ -3,15 +3,22 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
 
 #include "DrawableGroup.hpp"
+#include "StaticGeometry.hpp"
+#include "EntitySystems.hpp"
 #include "CollisionGroup.hpp"
 #include "InteractionGroup.hpp"
 #include "IntersectionGroup.hpp"
 #include "Events.hpp"
+#include "AssetReference.hpp"
+#include "ObjectPool.hpp"
 
 /**
- * @fn	template <class T> bool operator== (const std::unique_ptr<T>& lhs, T* rhs)
+ * @fn	template <class T, class D> bool operator== (const std::unique_ptr<T, D>& lhs, T* rhs)
  *
  * @brief	Equality operator for PhysicsObjects
  *
@@ -19,19 +26,20 @@
  * @date	30-1-2018
  *
  * @tparam	T	Generic type parameter.
+ * @tparam	D	The deleter type.
  * @param 		  	lhs	The first instance to compare.
  * @param [in,out]	rhs	If non-null, the second instance to compare.
  *
  * @return	True if the parameters are considered equivalent.
  */
 
-template <class T>
-bool operator== (const std::unique_ptr<T>& lhs, T* rhs) {
+template <class T, class D>
+bool operator== (const std::unique_ptr<T, D>& lhs, T* rhs) {
 	return &(*lhs) == rhs;
 }
 
 /**
- * @fn	template <class T> bool operator== (T* lhs, const std::unique_ptr<T>& rhs)
+ * @fn	template <class T, class D> bool operator== (T* lhs, const std::unique_ptr<T, D>& rhs)
  *
  * @brief	Equality operator for PhysicsObjects
  *
@@ -39,17 +47,52 @@ bool operator== (const std::unique_ptr<T>& lhs, T* rhs) {
  * @date	30-1-2018
  *
  * @tparam	T	Generic type parameter.
+ * @tparam	D	The deleter type.
  * @param [in,out]	lhs	If non-null, the first instance to compare.
  * @param 		  	rhs	The second instance to compare.
  *
  * @return	True if the parameters are considered equivalent.
  */
 
-template <class T>
-bool operator== (T* lhs, const std::unique_ptr<T>& rhs) {
+template <class T, class D>
+bool operator== (T* lhs, const std::unique_ptr<T, D>& rhs) {
 	return lhs == &(*rhs);
 }
 
+/**
+ * @struct	ObjectHandle
+ *
+ * @brief	Refers to an object of a Map. A handle of a removed object stays invalid when its slot is reused.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct ObjectHandle {
+	/** @brief	Slot of the object */
+	uint32_t index = UINT32_MAX;
+
+	/** @brief	Incremented every time the slot is reused */
+	uint32_t generation = 0;
+
+	/**
+	 * @fn	bool ObjectHandle::operator==(const ObjectHandle& rhs) const
+	 *
+	 * @brief	Equality operator
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rhs	The right hand side.
+	 *
+	 * @return	True if both refer to the same object.
+	 */
+
+	bool operator==(const ObjectHandle& rhs) const {
+		return index == rhs.index && generation == rhs.generation;
+	}
+};
+
 /**
  * @class	Map
  *
@@ -60,22 +103,103 @@ bool operator== (T* lhs, const std::unique_ptr<T>& rhs) {
  * @date	2018-01-25
  */
 
-class Map : public std::vector<std::unique_ptr<Body>> {
+class Map : public std::vector<ObjectArena::Pointer<Body>> {
 	/** @brief	Vector of drawables */
 	DrawableGroup drawableGroup;
 
+	/** @brief	Batched level rectangles, drawn as a single entry of drawableGroup. Heap allocated so the entry survives moving the map. */
+	std::unique_ptr<StaticGeometry> staticGeometry = std::make_unique<StaticGeometry>();
+
+	/** @brief	True once staticGeometry has been added to drawableGroup */
+	bool staticGeometryAdded = false;
+
 	/** @brief	Vector of collidables directly managed by Map */
 	CollisionGroup primaryCollisionGroup;
 
 	/** @brief	Interaction group references that Map::resolve() should resolve as well. unique_ptrs are used since the InteractionGroups belong to this map only. */
-	std::vector<std::unique_ptr<InteractionGroup>> interactionGroups;
+	std::vector<ObjectArena::Pointer<InteractionGroup>> interactionGroups;
+
+	/** @brief	References to the assets this map is built from, keeping them resident for the lifetime of the map */
+	std::vector<AssetReference> assets;
+
+	/**
+	 * @struct	Slot
+	 *
+	 * @brief	Where an object handed out by Map::addObject() is stored.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Slot {
+		/** @brief	The object, nullptr if the slot is free */
+		Body* object;
+
+		/** @brief	Position of the object in the map */
+		uint32_t position;
+
+		/** @brief	Generation of the object in the slot */
+		uint32_t generation;
+
+		/** @brief	True once the object is queued for removal */
+		bool removing;
+	};
+
+	/** @brief	Slot per handle index */
+	std::vector<Slot> slots;
+
+	/** @brief	Per position in the map, the slot of the object */
+	std::vector<uint32_t> slotIndices;
+
+	/** @brief	Free slots */
+	std::vector<uint32_t> freeSlots;
+
+	/** @brief	Slot of every object, to find the handle of an object */
+	std::unordered_map<const Body*, uint32_t> objectSlots;
+
+	/** @brief	Objects queued by Map::removeObject(), removed by Map::flushRemovals() */
+	std::vector<ObjectHandle> removals;
+
+	/** @brief	Drawables queued by Map::eraseDrawable(), erased by Map::flushRemovals() */
+	std::unordered_set<const sf::Drawable*> drawableRemovals;
+
+	/** @brief	Storage of the objects and groups created by the map. Declared after interactionGroups, so assigning a map destroys the old groups before their storage. */
+	ObjectArena arena;
 
 public:
 	EventSource<Body&> objectAdded;
 	EventSource<Body&> objectRemoving;
 
 	/**
-	 * @fn	void Map::addDrawable(Drawable* drawable)
+	 * @fn	Map::Map()
+	 *
+	 * @brief	Default constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	Map() { }
+
+	Map(Map&&) = default;
+	Map& operator=(Map&&) = default;
+
+	/**
+	 * @fn	Map::~Map()
+	 *
+	 * @brief	Destroys the objects and groups before the arena that stores them
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~Map() {
+		clear();
+		interactionGroups.clear();
+	}
+
+	/**
+	 * @fn	void Map::addDrawable(Drawable* drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f)
 	 *
 	 * @brief	Adds a drawable to drawableGroup
 	 *
@@ -83,14 +207,17 @@ public:
 	 * @date	2018-01-25
 	 *
 	 * @param [in,out]	drawable	If non-null, the drawable.
+	 * @param 		  	mode		(Optional) How the drawable is culled, use CullMode::Static for level geometry.
+	 * @param 		  	layer		(Optional) The layer to draw the drawable in.
+	 * @param 		  	z			(Optional) Order within the layer, higher values are drawn in front.
 	 */
 
-	void addDrawable(sf::Drawable* drawable) {
-		drawableGroup.add(*drawable);
+	void addDrawable(sf::Drawable* drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f) {
+		drawableGroup.add(*drawable, mode, layer, z);
 	}
 
 	/**
-	 * @fn	void Map::addDrawable(Drawable& drawable)
+	 * @fn	void Map::addDrawable(Drawable& drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f)
 	 *
 	 * @brief	Adds a drawable to drawableGroup
 	 *
@@ -98,14 +225,134 @@ public:
 	 * @date	2018-01-25
 	 *
 	 * @param [in,out]	drawable	The drawable.
+	 * @param 		  	mode		(Optional) How the drawable is culled, use CullMode::Static for level geometry.
+	 * @param 		  	layer		(Optional) The layer to draw the drawable in.
+	 * @param 		  	z			(Optional) Order within the layer, higher values are drawn in front.
+	 */
+
+	void addDrawable(sf::Drawable& drawable, CullMode mode = CullMode::Dynamic, RenderLayer layer = RenderLayer::Level, float z = 0.0f) {
+		drawableGroup.add(drawable, mode, layer, z);
+	}
+
+	/**
+	 * @fn	void Map::addStaticGeometry(sf::RectangleShape& rectangle)
+	 *
+	 * @brief	Adds a level rectangle to the batched static geometry.
+	 * 			The batches are drawn in RenderLayer::Level.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	rectangle	The rectangle.
+	 */
+
+	void addStaticGeometry(sf::RectangleShape& rectangle) {
+		if (!staticGeometryAdded) {
+			drawableGroup.add(*staticGeometry, CullMode::Never, RenderLayer::Level);
+			staticGeometryAdded = true;
+		}
+
+		staticGeometry->add(rectangle);
+	}
+
+	/**
+	 * @fn	void Map::addStaticGeometry(EntityWorld& world)
+	 *
+	 * @brief	Adds the sprites of the entities of world that do not move to the batched static geometry, see SpriteSystem::bake().
+	 * 			The batches are drawn in RenderLayer::Level.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	world	The world.
+	 */
+
+	void addStaticGeometry(EntityWorld& world) {
+		if (!staticGeometryAdded) {
+			drawableGroup.add(*staticGeometry, CullMode::Never, RenderLayer::Level);
+			staticGeometryAdded = true;
+		}
+
+		SpriteSystem::bake(world, *staticGeometry);
+	}
+
+	/**
+	 * @fn	void Map::setChunkCaching(bool enabled)
+	 *
+	 * @brief	Enables or disables drawing the static geometry through pre-rendered chunks, see StaticGeometry
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	enabled	True to draw through pre-rendered chunks.
+	 */
+
+	void setChunkCaching(bool enabled) {
+		staticGeometry->setChunkCaching(enabled);
+	}
+
+	/**
+	 * @fn	void Map::updateDrawable(sf::Drawable& drawable)
+	 *
+	 * @brief	Updates the spatial index or static geometry batch after a drawable added with CullMode::Static
+	 * 			or Map::addStaticGeometry() has been moved, resized or retextured
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	drawable	The drawable.
 	 */
 
-	void addDrawable(sf::Drawable& drawable) {
-		drawableGroup.add(drawable);
+	void updateDrawable(sf::Drawable& drawable) {
+		drawableGroup.update(drawable);
+		staticGeometry->update(drawable);
 	}
 
+	/**
+	 * @fn	void Map::eraseDrawable(sf::Drawable& drawable)
+	 *
+	 * @brief	Stops drawing drawable at the end of the tick. The drawable is erased together with the removed objects
+	 * 			by Map::flushRemovals(), so erasing it does not rebuild the spatial index on its own.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	drawable	The drawable.
+	 */
+
 	void eraseDrawable(sf::Drawable& drawable) {
-		drawableGroup.erase(drawable);
+		drawableRemovals.insert(&drawable);
+		staticGeometry->erase(drawable);
+	}
+
+	/**
+	 * @fn	void Map::addAsset(const AssetReference& asset)
+	 *
+	 * @brief	Keeps the referenced asset resident for the lifetime of this map
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	asset	The asset reference.
+	 */
+
+	void addAsset(const AssetReference& asset) {
+		assets.push_back(asset);
+	}
+
+	/**
+	 * @fn	const std::vector<AssetReference>& Map::getAssets() const
+	 *
+	 * @brief	Gets the references to the assets this map is built from
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The asset references.
+	 */
+
+	const std::vector<AssetReference>& getAssets() const {
+		return assets;
 	}
 
 	/**
@@ -169,17 +416,98 @@ public:
 	}
 
 	/**
-	 * @fn	void Map::draw(sf::RenderTarget& renderTarget)
+	 * @struct	Snapshot
+	 *
+	 * @brief	The state of a map that changes while playing, restored with Map::restore().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Snapshot {
+		/** @brief	The objects, in the order of the map */
+		std::vector<ObjectHandle> handles;
+		/** @brief	The addresses of the objects, to leave the drawables of removed objects out */
+		std::vector<const Body*> addresses;
+		/** @brief	The state of the objects, in the order of the map */
+		std::vector<Body::Snapshot> objects;
+		/** @brief	The drawn drawables */
+		DrawableGroup::Snapshot drawables;
+	};
+
+	/**
+	 * @fn	Snapshot Map::getSnapshot() const
+	 *
+	 * @brief	Captures the positions and velocities of the objects and which drawables are drawn
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The snapshot.
+	 */
+
+	Snapshot getSnapshot() const {
+		Snapshot snapshot;
+		snapshot.handles.reserve(size());
+		snapshot.addresses.reserve(size());
+		snapshot.objects.reserve(size());
+
+		for (std::size_t i = 0; i < size(); i++) {
+			const uint32_t slot = slotIndices[i];
+
+			snapshot.handles.push_back({ slot, slots[slot].generation });
+			snapshot.addresses.push_back((*this)[i].get());
+			snapshot.objects.push_back((*this)[i]->getSnapshot());
+		}
+
+		snapshot.drawables = drawableGroup.getSnapshot();
+
+		return snapshot;
+	}
+
+	/**
+	 * @fn	void Map::restore(const Snapshot& snapshot)
+	 *
+	 * @brief	Restores the state captured by Map::getSnapshot(), objects added after capturing keep their state
+	 * 			and objects removed after capturing stay removed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	snapshot	The snapshot.
+	 */
+
+	void restore(const Snapshot& snapshot) {
+		std::unordered_set<const sf::Drawable*> destroyed;
+
+		// The snapshot decides which drawables are drawn.
+		drawableRemovals.clear();
+
+		for (std::size_t i = 0; i < snapshot.handles.size(); i++) {
+			if (Body* object = getObject(snapshot.handles[i])) {
+				object->restore(snapshot.objects[i]);
+			}
+			else {
+				destroyed.insert(snapshot.addresses[i]);
+			}
+		}
+
+		drawableGroup.restore(snapshot.drawables, destroyed);
+	}
+
+	/**
+	 * @fn	void Map::draw(RenderList& renderTarget)
 	 *
-	 * @brief	Draws the drawableGroup to the given render target
+	 * @brief	Draws the drawableGroup to the given render list, culling drawables outside of its current view
 	 *
 	 * @author	Julian
 	 * @date	2018-01-25
 	 *
-	 * @param [in,out]	renderTarget	The render target.
+	 * @param [in,out]	renderTarget	The render list.
 	 */
 
-	void draw(sf::RenderTarget& renderTarget) {
+	void draw(RenderList& renderTarget) {
+		staticGeometry->prepare(renderTarget.getView());
 		drawableGroup.draw(renderTarget);
 	}
 
@@ -195,7 +523,7 @@ public:
 	void resolve() {
 		primaryCollisionGroup.resolve();
 
-		for (const std::unique_ptr<InteractionGroup>& collisionGroup : interactionGroups) {
+		for (const ObjectArena::Pointer<InteractionGroup>& collisionGroup : interactionGroups) {
 			collisionGroup->resolve();
 		}
 	}
@@ -219,6 +547,42 @@ public:
 		interactionGroups.emplace_back(collisionGroup);
 	}
 
+	/**
+	 * @fn	template<class T, class... Args> T& Map::createObjectGroup(Args&&... args)
+	 *
+	 * @brief	Creates an interaction group in the arena of the map and adds it
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T   	The type of the group.
+	 * @tparam	Args	The types of the constructor arguments.
+	 * @param	args	The constructor arguments.
+	 *
+	 * @return	The group, owned by the map.
+	 */
+
+	template<class T, class... Args>
+	T& createObjectGroup(Args&&... args) {
+		ObjectArena::Pointer<T> group = arena.create<T>(std::forward<Args>(args)...);
+		T& reference = *group;
+
+		interactionGroups.emplace_back(std::move(group));
+
+		return reference;
+	}
+
+	/**
+	 * @fn	void Map::removeObjectGroup(InteractionGroup& collisionGroup)
+	 *
+	 * @brief	Removes and destroys an interaction group
+	 *
+	 * @author	Julian
+	 * @date	2018-01-25
+	 *
+	 * @param [in,out]	collisionGroup	The group.
+	 */
+
 	void removeObjectGroup(InteractionGroup& collisionGroup) {
 		removeObjectGroup(&collisionGroup);
 	}
@@ -227,46 +591,157 @@ public:
 		auto it = std::find(interactionGroups.begin(), interactionGroups.end(), collisionGroup);
 
 		if (it != interactionGroups.end()) {
-			it->release();
 			interactionGroups.erase(it);
 		}
 	}
 
 	/**
-	 * @fn	void Map::addObject(Body& physicsObject)
+	 * @fn	ObjectHandle Map::addObject(Body& physicsObject)
 	 *
-	 * @brief	Adds an object
+	 * @brief	Adds an object, the map takes ownership
 	 *
 	 * @author	Wiebe
 	 * @date	30-1-2018
 	 *
 	 * @param [in,out]	physicsObject	The physics object.
+	 *
+	 * @return	The handle of the object.
 	 */
 
-	void addObject(Body& physicsObject) {
-		addObject(&physicsObject);
+	ObjectHandle addObject(Body& physicsObject) {
+		return addObject(&physicsObject);
 	}
 
 	/**
-	 * @fn	void Map::addObject(Body* physicsObject)
+	 * @fn	ObjectHandle Map::addObject(Body* physicsObject)
 	 *
-	 * @brief	Adds an object
+	 * @brief	Adds an object, the map takes ownership
 	 *
 	 * @author	Wiebe
 	 * @date	30-1-2018
 	 *
 	 * @param [in,out]	physicsObject	If non-null, the physics object.
+	 *
+	 * @return	The handle of the object.
+	 */
+
+	ObjectHandle addObject(Body* physicsObject) {
+		return addObject(ObjectArena::Pointer<Body>(physicsObject));
+	}
+
+	/**
+	 * @fn	template<class T, class... Args> T& Map::createObject(Args&&... args)
+	 *
+	 * @brief	Creates an object in the arena of the map and adds it.
+	 * 			objectAdded fires before the caller gets to set up the object.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T   	The type of the object.
+	 * @tparam	Args	The types of the constructor arguments.
+	 * @param	args	The constructor arguments.
+	 *
+	 * @return	The object, owned by the map.
+	 */
+
+	template<class T, class... Args>
+	T& createObject(Args&&... args) {
+		ObjectArena::Pointer<T> object = arena.create<T>(std::forward<Args>(args)...);
+		T& reference = *object;
+
+		addObject(std::move(object));
+
+		return reference;
+	}
+
+	/**
+	 * @fn	ObjectHandle Map::addObject(ObjectArena::Pointer<Body> physicsObject)
+	 *
+	 * @brief	Adds an object, the map takes ownership
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	physicsObject	The physics object.
+	 *
+	 * @return	The handle of the object.
+	 */
+
+	ObjectHandle addObject(ObjectArena::Pointer<Body> physicsObject) {
+		Body* object = physicsObject.get();
+		uint32_t slot;
+
+		if (freeSlots.empty()) {
+			slot = static_cast<uint32_t>(slots.size());
+			slots.push_back({ nullptr, 0, 0, false });
+		}
+		else {
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+		}
+
+		slots[slot].object = object;
+		slots[slot].position = static_cast<uint32_t>(size());
+		slots[slot].removing = false;
+
+		push_back(std::move(physicsObject));
+		slotIndices.push_back(slot);
+		objectSlots[object] = slot;
+
+		objectAdded.fire(*object);
+
+		return { slot, slots[slot].generation };
+	}
+
+	/**
+	 * @fn	Body* Map::getObject(ObjectHandle handle) const
+	 *
+	 * @brief	Gets the object of a handle
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	handle	The handle.
+	 *
+	 * @return	The object, nullptr if it has been removed.
+	 */
+
+	Body* getObject(ObjectHandle handle) const {
+		if (handle.index >= slots.size() || slots[handle.index].generation != handle.generation) {
+			return nullptr;
+		}
+
+		return slots[handle.index].object;
+	}
+
+	/**
+	 * @fn	ObjectHandle Map::getHandle(const Body& physicsObject) const
+	 *
+	 * @brief	Gets the handle of an object of this map
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	physicsObject	The physics object.
+	 *
+	 * @return	The handle, invalid if the object is not part of this map.
 	 */
 
-	void addObject(Body* physicsObject) {
-		emplace_back(physicsObject);
-		objectAdded.fire(*physicsObject);
+	ObjectHandle getHandle(const Body& physicsObject) const {
+		auto it = objectSlots.find(&physicsObject);
+
+		if (it == objectSlots.end()) {
+			return ObjectHandle();
+		}
+
+		return { it->second, slots[it->second].generation };
 	}
 
 	/**
 	 * @fn	void Map::removeObject(Body& physicsObject)
 	 *
-	 * @brief	Removes the object from the map
+	 * @brief	Queues the object for removal at the end of the tick, see Map::flushRemovals()
 	 *
 	 * @author	Wiebe
 	 * @date	30-1-2018
@@ -275,13 +750,13 @@ public:
 	 */
 
 	void removeObject(Body& physicsObject) {
-		removeObject(&physicsObject);
+		removeObject(getHandle(physicsObject));
 	}
 
 	/**
 	 * @fn	void Map::removeObject(Body* physicsObject)
 	 *
-	 * @brief	Removes the object from the map
+	 * @brief	Queues the object for removal at the end of the tick, see Map::flushRemovals()
 	 *
 	 * @author	Wiebe
 	 * @date	30-1-2018
@@ -290,16 +765,109 @@ public:
 	 */
 
 	void removeObject(Body* physicsObject) {
-		objectRemoving.fire(*physicsObject);
+		if (physicsObject != nullptr) {
+			removeObject(*physicsObject);
+		}
+	}
 
-		auto it = std::find(begin(), end(), physicsObject);
+	/**
+	 * @fn	void Map::removeObject(ObjectHandle handle)
+	 *
+	 * @brief	Queues the object for removal at the end of the tick, see Map::flushRemovals().
+	 * 			Queueing an object twice or a removed object does nothing.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	handle	The handle of the object.
+	 */
 
-		if (it != end()) {
-			it->release();
-			erase(it);
+	void removeObject(ObjectHandle handle) {
+		if (getObject(handle) != nullptr && !slots[handle.index].removing) {
+			slots[handle.index].removing = true;
+			removals.push_back(handle);
 		}
-		
-		drawableGroup.erase(*physicsObject);
-		primaryCollisionGroup.erase(*physicsObject);
+	}
+
+	/**
+	 * @fn	void Map::flushRemovals()
+	 *
+	 * @brief	Removes and destroys the objects queued by Map::removeObject() and erases the drawables queued by
+	 * 			Map::eraseDrawable(), to be called at the end of a tick.
+	 * 			objectRemoving fires for every object before any of them is destroyed. The queued objects are marked
+	 * 			as removing, so the collision and interaction groups, the drawables and the objects of the map are each
+	 * 			compacted in a single pass that keeps the order of the remaining objects. Removing many objects costs
+	 * 			about as much as removing one.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void flushRemovals() {
+		if (removals.empty()) {
+			drawableGroup.erase(drawableRemovals);
+			drawableRemovals.clear();
+			return;
+		}
+
+		// Handlers may queue more removals, those are flushed in the same call.
+		for (std::size_t i = 0; i < removals.size(); i++) {
+			objectRemoving.fire(*slots[removals[i].index].object);
+		}
+
+		std::unordered_set<const sf::Drawable*> drawables;
+		drawables.swap(drawableRemovals);
+
+		std::unordered_set<const Collidable*> collidables;
+		collidables.reserve(removals.size());
+		drawables.reserve(drawables.size() + removals.size());
+
+		for (const ObjectHandle& handle : removals) {
+			Body& object = *slots[handle.index].object;
+
+			staticGeometry->erase(object);
+			collidables.insert(&object);
+			drawables.insert(&object);
+		}
+
+		primaryCollisionGroup.erase(collidables);
+
+		for (const ObjectArena::Pointer<InteractionGroup>& interactionGroup : interactionGroups) {
+			interactionGroup->erase(collidables);
+		}
+
+		drawableGroup.erase(drawables);
+
+		std::size_t kept = 0;
+
+		for (std::size_t position = 0; position < size(); position++) {
+			const uint32_t index = slotIndices[position];
+			Slot& slot = slots[index];
+
+			if (slot.removing) {
+				objectSlots.erase(slot.object);
+
+				// Resetting the pointer destroys the object.
+				(*this)[position].reset();
+
+				slot.object = nullptr;
+				slot.removing = false;
+				slot.generation++;
+				freeSlots.push_back(index);
+				continue;
+			}
+
+			if (kept != position) {
+				(*this)[kept] = std::move((*this)[position]);
+				slotIndices[kept] = index;
+				slot.position = static_cast<uint32_t>(kept);
+			}
+
+			kept++;
+		}
+
+		erase(begin() + kept, end());
+		slotIndices.resize(kept);
+		removals.clear();
 	}
 };
\ No newline at end of file
@@ -6,9 +6,11 @@
 #include "KeyValuePair.hpp"
 #include "Map.hpp"
 #include "AssetManager.hpp"
+#include "AssetReference.hpp"
 #include "Body.hpp"
 #include "MapItemProperties.hpp"
 #include "StreamManipulators.hpp"
+#include "EntityWorld.hpp"
 
 /**
  * @class	MapFactory
@@ -31,6 +33,82 @@ class MapFactory : public BaseFactory<void, std::string, Map&, const MapItemProp
 	/** @brief	The input */
 	std::istream& input;
 
+	/**
+	 * @fn	static Entity MapFactory::createEntity(EntityWorld& world, const MapItemProperties& properties)
+	 *
+	 * @brief	Creates an entity that only has the components its item declares.
+	 * 			Position declares a TransformComponent, Size an AABBComponent, Velocity a VelocityComponent,
+	 * 			Color, TextureId and TextureRect a SpriteComponent, Value a TriggerComponent and Clickable a ClickableComponent.
+	 * 			The entity is not written back to the map file, so it gets no SerializableComponent.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	world	  	The world the entity is added to.
+	 * @param 		  	properties	The properties of the item.
+	 *
+	 * @return	The entity.
+	 */
+
+	static Entity createEntity(EntityWorld& world, const MapItemProperties& properties) {
+		TransformComponent transform;
+		AABBComponent box;
+		VelocityComponent velocity;
+		SpriteComponent sprite;
+		TriggerComponent trigger;
+
+		bool hasTransform = false;
+		bool hasBox = false;
+		bool hasVelocity = false;
+		bool hasSprite = false;
+		bool hasTrigger = false;
+		bool clickable = false;
+
+		properties.read({
+			{ "Position", Type::Vector, [&](Value value) { transform.position = *value.vectorValue; hasTransform = true; } },
+			{ "Size", Type::Vector, [&](Value value) { box.halfSize = *value.vectorValue / 2.0f; hasBox = true; } },
+			{ "CanCollide", Type::Bool, [&](Value value) { box.solid = value.b; } },
+			{ "Velocity", Type::Vector, [&](Value value) { velocity.velocity = *value.vectorValue; hasVelocity = true; } },
+			{ "Color", Type::Color, [&](Value value) { sprite.color = *value.colorValue; hasSprite = true; } },
+			{ "TextureId", Type::String, [&](Value value) { sprite.texture = &AssetManager::instance()->getTexture(*value.stringValue); hasSprite = true; } },
+			{ "TextureRect", Type::Rect, [&](Value value) { sprite.textureRect = sf::IntRect(*value.rectValue); hasSprite = true; } },
+			{ "Value", Type::Float, [&](Value value) { trigger.value = value.floatValue; hasTrigger = true; } },
+			{ "Clickable", Type::Bool, [&](Value value) { clickable = value.b; } }
+		});
+
+		// Creating the entity with all its components at once avoids moving it through intermediate archetypes.
+		uint32_t mask = hasTransform ? ComponentTraits<TransformComponent>::bit : 0;
+		mask |= hasBox ? ComponentTraits<AABBComponent>::bit : 0;
+		mask |= hasVelocity ? ComponentTraits<VelocityComponent>::bit : 0;
+		mask |= hasSprite ? ComponentTraits<SpriteComponent>::bit : 0;
+		mask |= hasTrigger ? ComponentTraits<TriggerComponent>::bit : 0;
+		mask |= clickable ? ComponentTraits<ClickableComponent>::bit : 0;
+
+		Entity entity = world.create(mask);
+
+		if (hasTransform) {
+			*world.get<TransformComponent>(entity) = transform;
+		}
+
+		if (hasBox) {
+			*world.get<AABBComponent>(entity) = box;
+		}
+
+		if (hasVelocity) {
+			*world.get<VelocityComponent>(entity) = velocity;
+		}
+
+		if (hasSprite) {
+			*world.get<SpriteComponent>(entity) = sprite;
+		}
+
+		if (hasTrigger) {
+			*world.get<TriggerComponent>(entity) = trigger;
+		}
+
+		return entity;
+	}
+
 public:
 	/** @brief	Retrieve KeyValuePair::Type into local scope */
 	using Type = KeyValuePair::Type;
@@ -38,6 +116,43 @@ public:
 	/** @brief	Retrieve KeyValuePair::Value into local scope */
 	using Value = KeyValuePair::Value;
 
+	/**
+	 * @fn	Map MapFactory::buildMap(EntityWorld& world)
+	 *
+	 * @brief	Reads all the content from std::stream& input like MapFactory::buildMap(), but creates the level blocks,
+	 * 			the "rectangle" items, as entities in world instead of Body objects in the map. See MapFactory::createEntity().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	world	The world the level blocks are added to.
+	 *
+	 * @return	Newly generated map.
+	 */
+
+	Map buildMap(EntityWorld& world) {
+		Map map;
+
+		while (!input.eof()) {
+			std::string name;
+			input >> exceptions >> name;
+
+			MapItemProperties mapItemProperties;
+			input >> exceptions >> mapItemProperties;
+
+			if (name == "rectangle") {
+				createEntity(world, mapItemProperties);
+			}
+			else {
+				create(name, map, mapItemProperties);
+			}
+
+			input >> std::ws;
+		}
+
+		return map;
+	}
+
 	/**
 	 * @fn	Map MapFactory::buildMap()
 	 *
@@ -84,8 +199,8 @@ public:
 			std::string location;
 
 			properties.read({
-				{ "Id", Type::String, [&](Value value) { id = value; if (location.size() > 0) AssetManager::instance()->load(id, location); } },
-				{ "Location", Type::String, [&](Value value) { location = value; if (id.size() > 0) AssetManager::instance()->load(id, location); } }
+				{ "Id", Type::String, [&](Value value) { id = value; if (location.size() > 0) map.addAsset(AssetReference(id, location)); } },
+				{ "Location", Type::String, [&](Value value) { location = value; if (id.size() > 0) map.addAsset(AssetReference(id, location)); } }
 			});
 
 			if (id.size() == 0 || location.size() == 0) {
@@ -101,8 +216,8 @@ public:
 			bool loaded = false;
 
 			properties.read({
-				{ "Id", Type::String, [&](Value value) { id = value; if (location.size() > 0) AssetManager::instance()->loadTexture(id, location); } },
-				{ "Location", Type::String, [&](Value value) { location = value; if (id.size() > 0) AssetManager::instance()->loadTexture(id, location); } },
+				{ "Id", Type::String, [&](Value value) { id = value; if (location.size() > 0) map.addAsset(AssetReference(id, location)); } },
+				{ "Location", Type::String, [&](Value value) { location = value; if (id.size() > 0) map.addAsset(AssetReference(id, location)); } },
 				{ "Repeated", Type::Bool, [&](Value value) { if (id.size() > 0) AssetManager::instance()->getTexture(id).setRepeated(value); } },
 				{ "Smooth", Type::Bool, [&](Value value) { if (id.size() > 0) AssetManager::instance()->getTexture(id).setSmooth(value); } }
 			});
@@ -114,7 +229,7 @@ public:
 
 		/** @brief	Register rectangle loader */
 		registerCreateMethod("rectangle", [&](Map& map, const MapItemProperties& properties) {
-			Body* rectangle = new Body();
+			Body* rectangle = &map.createObject<Body>();
 
 			bool canCollide = true;
 
@@ -127,8 +242,7 @@ public:
 				{ "CanCollide", Type::Bool, [&](Value value) { canCollide = value; } }
 			});
 
-			map.addDrawable(rectangle);
-			map.addObject(rectangle);
+			map.addStaticGeometry(*rectangle);
 
 			if (canCollide) {
 				map.addCollidable(rectangle);
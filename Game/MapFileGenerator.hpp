@@ -133,7 +133,7 @@ public:
 		generateGeneric(player, "player");
 		generateGeneric(death, "death");
 
-		for (const std::unique_ptr<Body>& object : map) {
+		for (const ObjectArena::Pointer<Body>& object : map) {
 			try {
 				object->writeToFile(outputFileStream);
 			}
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <new>
+#include <type_traits>
+
+/**
+ * @class	ObjectPool
+ *
+ * @brief	Hands out storage for objects of one size from contiguous chunks.
+ *
+ * @detailed Storage is allocated a chunk of objects at a time and is never returned to the heap until the pool is destroyed.
+ * 			 Released storage is kept in a free list and handed out again first, so objects that are created
+ * 			 and destroyed repeatedly do not touch the heap. The pool does not construct or destroy objects,
+ * 			 every object has to be destroyed before the pool is.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ObjectPool {
+	/** @brief	Size of the storage of one object, rounded up to the alignment of std::max_align_t */
+	std::size_t objectSize;
+
+	/** @brief	Amount of objects per chunk */
+	std::size_t chunkCapacity;
+
+	/** @brief	The chunks */
+	std::vector<std::unique_ptr<unsigned char[]>> chunks;
+
+	/** @brief	Amount of objects handed out from the last chunk */
+	std::size_t chunkUsed;
+
+	/** @brief	Storage that has been released */
+	std::vector<void*> freeList;
+
+	/** @brief	Amount of storage that is handed out */
+	std::size_t used = 0;
+
+public:
+
+	/**
+	 * @fn	ObjectPool::ObjectPool(std::size_t objectSize, std::size_t chunkCapacity = 64)
+	 *
+	 * @brief	Constructor, nothing is allocated until the first object
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	objectSize   	Size of an object.
+	 * @param	chunkCapacity	(Optional) Amount of objects per chunk.
+	 */
+
+	ObjectPool(std::size_t objectSize, std::size_t chunkCapacity = 64) :
+		objectSize((objectSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)),
+		chunkCapacity(chunkCapacity),
+		chunkUsed(chunkCapacity)
+	{ }
+
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+
+	/**
+	 * @fn	void* ObjectPool::allocate()
+	 *
+	 * @brief	Gets storage for an object
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	Storage of the object size, aligned for any type.
+	 */
+
+	void* allocate() {
+		used++;
+
+		if (!freeList.empty()) {
+			void* storage = freeList.back();
+			freeList.pop_back();
+			return storage;
+		}
+
+		if (chunkUsed == chunkCapacity) {
+			// operator new[] aligns to std::max_align_t, objectSize keeps every object in the chunk aligned.
+			chunks.emplace_back(new unsigned char[objectSize * chunkCapacity]);
+			chunkUsed = 0;
+		}
+
+		return chunks.back().get() + objectSize * chunkUsed++;
+	}
+
+	/**
+	 * @fn	void ObjectPool::release(void* storage)
+	 *
+	 * @brief	Returns storage handed out by ObjectPool::allocate(), the object in it has to be destroyed already
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	storage	The storage.
+	 */
+
+	void release(void* storage) {
+		used--;
+		freeList.push_back(storage);
+	}
+
+	/**
+	 * @fn	std::size_t ObjectPool::size() const
+	 *
+	 * @brief	Gets the amount of storage that is handed out
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The amount of objects.
+	 */
+
+	std::size_t size() const {
+		return used;
+	}
+
+	/**
+	 * @fn	std::size_t ObjectPool::getByteSize() const
+	 *
+	 * @brief	Gets the amount of memory allocated for chunks
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The size in bytes.
+	 */
+
+	std::size_t getByteSize() const {
+		return chunks.size() * chunkCapacity * objectSize;
+	}
+};
+
+/**
+ * @struct	ObjectDeleter
+ *
+ * @brief	Deleter for std::unique_ptr that returns objects created by an ObjectArena to their pool.
+ * 			Without a pool the object is deleted, so objects created with new can be owned the same way.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct ObjectDeleter {
+	/** @brief	The pool the object is stored in, nullptr if it was created with new */
+	ObjectPool* pool = nullptr;
+
+	/**
+	 * @fn	template<class T> static void* ObjectDeleter::getStorage(T* object, std::true_type)
+	 *
+	 * @brief	Gets the storage of a polymorphic object, which starts at the most derived object and not where a (virtual) base pointer points
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	object	The object.
+	 *
+	 * @return	The storage.
+	 */
+
+	template<class T>
+	static void* getStorage(T* object, std::true_type) {
+		return dynamic_cast<void*>(object);
+	}
+
+	/**
+	 * @fn	template<class T> static void* ObjectDeleter::getStorage(T* object, std::false_type)
+	 *
+	 * @brief	Gets the storage of an object that is not polymorphic
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	object	The object.
+	 *
+	 * @return	The storage.
+	 */
+
+	template<class T>
+	static void* getStorage(T* object, std::false_type) {
+		return static_cast<void*>(object);
+	}
+
+	/**
+	 * @fn	template<class T> void ObjectDeleter::operator()(T* object) const
+	 *
+	 * @brief	Destroys an object
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	The type of the pointer, a polymorphic base with a virtual destructor or the type of the object itself.
+	 * @param [in,out]	object	The object.
+	 */
+
+	template<class T>
+	void operator()(T* object) const {
+		if (pool == nullptr) {
+			delete object;
+			return;
+		}
+
+		void* storage = getStorage(object, std::is_polymorphic<T>());
+		object->~T();
+		pool->release(storage);
+	}
+};
+
+/**
+ * @class	ObjectArena
+ *
+ * @brief	Creates objects of any type in ObjectPools, one pool per object size.
+ *
+ * @detailed The objects of a level are created from a handful of pools, so they lie next to each other in memory
+ * 			 and loading a level costs a few chunk allocations instead of one per object. Objects are owned through
+ * 			 a std::unique_ptr with an ObjectDeleter, and the arena has to outlive them; all of the pools
+ * 			 are freed at once when the arena is destroyed.
+ * 			 @code{.cpp}
+ * 			   ObjectArena arena;
+ * 			   ObjectArena::Pointer<Body> block = arena.create<Body>();
+ * 			   block->setSize({ 40.0f, 40.0f });
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ObjectArena {
+	/** @brief	The pools, by object size */
+	std::map<std::size_t, std::unique_ptr<ObjectPool>> pools;
+
+public:
+	/** @brief	Owning pointer to an object created by the arena */
+	template<class T>
+	using Pointer = std::unique_ptr<T, ObjectDeleter>;
+
+	ObjectArena() { }
+
+	ObjectArena(const ObjectArena&) = delete;
+	ObjectArena& operator=(const ObjectArena&) = delete;
+
+	ObjectArena(ObjectArena&&) = default;
+	ObjectArena& operator=(ObjectArena&&) = default;
+
+	/**
+	 * @fn	ObjectPool& ObjectArena::getPool(std::size_t size)
+	 *
+	 * @brief	Gets the pool for objects of a size, creating it if needed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	size	The size of an object.
+	 *
+	 * @return	The pool.
+	 */
+
+	ObjectPool& getPool(std::size_t size) {
+		std::unique_ptr<ObjectPool>& pool = pools[size];
+
+		if (!pool) {
+			pool = std::make_unique<ObjectPool>(size);
+		}
+
+		return *pool;
+	}
+
+	/**
+	 * @fn	template<class T, class... Args> Pointer<T> ObjectArena::create(Args&&... args)
+	 *
+	 * @brief	Creates an object in the pool of its size
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T   	The type of the object, aligned to at most std::max_align_t.
+	 * @tparam	Args	The types of the constructor arguments.
+	 * @param	args	The constructor arguments.
+	 *
+	 * @return	The object.
+	 */
+
+	template<class T, class... Args>
+	Pointer<T> create(Args&&... args) {
+		static_assert(alignof(T) <= alignof(std::max_align_t), "ObjectArena does not support over-aligned types");
+
+		ObjectPool& pool = getPool(sizeof(T));
+		void* storage = pool.allocate();
+
+		try {
+			return Pointer<T>(new (storage) T(std::forward<Args>(args)...), ObjectDeleter{ &pool });
+		}
+		catch (...) {
+			pool.release(storage);
+			throw;
+		}
+	}
+
+	/**
+	 * @fn	std::size_t ObjectArena::getByteSize() const
+	 *
+	 * @brief	Gets the amount of memory allocated by the pools
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The size in bytes.
+	 */
+
+	std::size_t getByteSize() const {
+		std::size_t size = 0;
+
+		for (const auto& pool : pools) {
+			size += pool.second->getByteSize();
+		}
+
+		return size;
+	}
+};
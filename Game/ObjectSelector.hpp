@@ -4,6 +4,8 @@
 
 #include "Map.hpp"
 #include "GameObject.hpp"
+#include "RenderList.hpp"
+#include "Renderable.hpp"
 
 /**
  * @class	ObjectSelector
@@ -14,7 +16,7 @@
  * @date	2018-01-30
  */
 
-class ObjectSelector : public sf::Drawable, public GameObject {
+class ObjectSelector : public sf::Drawable, public Renderable, public GameObject {
 	/** @brief	The selection */
 	Body* selection;
 
@@ -163,7 +165,7 @@ public:
 		dragging = true;
 
 		if (selection != nullptr) {
-			offset = game.window->mapCoordsToPixel(selection->getPosition()) - sf::Mouse::getPosition(*game.window);
+			offset = game.renderList->mapCoordsToPixel(selection->getPosition()) - sf::Mouse::getPosition(*game.window);
 		}
 	}
 
@@ -227,15 +229,15 @@ public:
 			if (key == sf::Keyboard::Key::Delete) {
 				if (selection != nullptr) {
 					std::cout << "removing from map " << &map << std::endl;
+					// The map destroys the object at the end of the tick.
 					map.removeObject(selection);
-					delete selection;
 					selection = nullptr;
 				}
 			}
 		});
 
 		mouseLeftButtonDown = game.mouse.mouseLeftButtonDown.connect([this](sf::Vector2i pos) {
-			sf::Vector2f posCoords = game.window->mapPixelToCoords(pos);
+			sf::Vector2f posCoords = game.renderList->mapPixelToCoords(pos);
 
 			if (boundingBox.getGlobalBounds().contains(posCoords)) {
 				startDrag();
@@ -265,10 +267,10 @@ public:
 		mouseMovedConn = game.mouse.mouseMoved.connect([this](sf::Vector2i pos) {
 			if (selection != nullptr) {
 				if (dragging == true) {
-					selection->setPosition(game.window->mapPixelToCoords(sf::Mouse::getPosition(*game.window)) + static_cast<sf::Vector2f>(offset));
+					selection->setPosition(game.renderList->mapPixelToCoords(sf::Mouse::getPosition(*game.window)) + static_cast<sf::Vector2f>(offset));
 				}
 				else if (resizeDirection != ResizeFace::None) {
-					sf::Vector2f mousePos = game.window->mapPixelToCoords(sf::Mouse::getPosition(*game.window));
+					sf::Vector2f mousePos = game.renderList->mapPixelToCoords(sf::Mouse::getPosition(*game.window));
 
 					if (resizeDirection == ResizeFace::Top) {
 						selection->resize(resizeOrigin.y - mousePos.y, ResizeFace::Top);
@@ -285,6 +287,8 @@ public:
 
 					resizeOrigin = mousePos;
 				}
+
+				map.updateDrawable(*selection);
 			}
 		});
 	}
@@ -353,6 +357,10 @@ public:
 	};
 
 	void draw(sf::RenderTarget& renderTarget, sf::RenderStates renderStates) const override {
+		RenderList::drawTo(renderTarget, *this, renderStates);
+	}
+
+	void draw(RenderList& renderTarget, sf::RenderStates renderStates) const override {
 		renderTarget.draw(boundingBox);
 		renderTarget.draw(topResizeHandle);
 		renderTarget.draw(bottomResizeHandle);
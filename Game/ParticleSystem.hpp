@@ -0,0 +1,631 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdint>
+
+#include "RenderList.hpp"
+#include "Renderable.hpp"
+
+/**
+ * @struct	ParticleEffect
+ *
+ * @brief	Describes the particles an emitter spawns.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+struct ParticleEffect {
+	/** @brief	Texture of the particles, nullptr for plain colored squares */
+	const sf::Texture* texture = nullptr;
+
+	/** @brief	Color when spawned */
+	sf::Color startColor = sf::Color::White;
+
+	/** @brief	Color at the end of the lifetime */
+	sf::Color endColor = sf::Color::Transparent;
+
+	/** @brief	Width and height when spawned */
+	float startSize = 6.0f;
+
+	/** @brief	Width and height at the end of the lifetime */
+	float endSize = 2.0f;
+
+	/** @brief	Lowest spawn speed in units per second */
+	float minSpeed = 50.0f;
+
+	/** @brief	Highest spawn speed in units per second */
+	float maxSpeed = 150.0f;
+
+	/** @brief	Center of the spawn directions in degrees, 0 points right and 90 down */
+	float direction = 0.0f;
+
+	/** @brief	Range of the spawn directions around direction in degrees, 360 spawns in every direction */
+	float spread = 360.0f;
+
+	/** @brief	Shortest lifetime in seconds */
+	float minLifetime = 0.5f;
+
+	/** @brief	Longest lifetime in seconds */
+	float maxLifetime = 1.0f;
+
+	/** @brief	Acceleration in units per second squared, such as gravity */
+	sf::Vector2f acceleration;
+};
+
+/**
+ * @class	ParticleSystem
+ *
+ * @brief	Simulates and draws short lived particles for gameplay effects.
+ *
+ * @detailed Particles are kept per texture in a pool of fixed capacity. A pool stores every particle property in its own array,
+ * 			 so ParticleSystem::update() runs simple loops over contiguous floats that the compiler can vectorize.
+ * 			 Dead particles are replaced by the last live one, keeping the live particles at the front of the arrays.
+ * 			 Every pool writes its quads into a preallocated sf::VertexArray that is drawn as a single command,
+ * 			 so spawning, simulating and drawing particles never allocates. Particles spawned into a full pool are dropped.
+ * 			 @code{.cpp}
+ * 			   particles.burst(sparks, player.getPosition(), 100);
+ * 			   std::size_t trail = particles.attach(player, smoke, 30.0f);
+ * 			   // every simulation tick
+ * 			   particles.update(elapsedTime);
+ * 			   map.addDrawable(particles, CullMode::Never, RenderLayer::Effects);
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class ParticleSystem : public sf::Drawable, public Renderable {
+	/**
+	 * @struct	Pool
+	 *
+	 * @brief	The particles that share a texture, stored as structure of arrays.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Pool {
+		/** @brief	Texture of the particles, may be nullptr */
+		const sf::Texture* texture;
+
+		/** @brief	Amount of live particles, they occupy the first count elements of every array */
+		std::size_t count = 0;
+
+		/** @brief	Positions */
+		std::vector<float> x, y;
+
+		/** @brief	Velocities */
+		std::vector<float> vx, vy;
+
+		/** @brief	Accelerations */
+		std::vector<float> ax, ay;
+
+		/** @brief	Seconds since spawning */
+		std::vector<float> age;
+
+		/** @brief	One divided by the lifetime, so the progress of a particle is age * inverseLifetime */
+		std::vector<float> inverseLifetime;
+
+		/** @brief	Sizes when spawned and at the end of the lifetime */
+		std::vector<float> startSize, endSize;
+
+		/** @brief	Colors when spawned and at the end of the lifetime */
+		std::vector<sf::Color> startColor, endColor;
+
+		/** @brief	Four vertices per particle, only the first count * 4 are drawn */
+		sf::VertexArray vertices;
+
+		/**
+		 * @fn	Pool::Pool(const sf::Texture* texture, std::size_t capacity)
+		 *
+		 * @brief	Allocates a pool for capacity particles
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	texture 	Texture of the particles, may be nullptr.
+		 * @param	capacity	Maximum amount of live particles.
+		 */
+
+		Pool(const sf::Texture* texture, std::size_t capacity) :
+			texture(texture),
+			x(capacity), y(capacity), vx(capacity), vy(capacity), ax(capacity), ay(capacity),
+			age(capacity), inverseLifetime(capacity), startSize(capacity), endSize(capacity),
+			startColor(capacity), endColor(capacity),
+			vertices(sf::Quads, capacity * 4)
+		{ }
+
+		/**
+		 * @fn	std::size_t Pool::capacity() const
+		 *
+		 * @brief	Gets the maximum amount of live particles
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The capacity.
+		 */
+
+		std::size_t capacity() const {
+			return x.size();
+		}
+
+		/**
+		 * @fn	void Pool::kill(std::size_t i)
+		 *
+		 * @brief	Removes particle i by moving the last live particle into its place
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	i	Index of the particle.
+		 */
+
+		void kill(std::size_t i) {
+			const std::size_t last = --count;
+
+			x[i] = x[last];
+			y[i] = y[last];
+			vx[i] = vx[last];
+			vy[i] = vy[last];
+			ax[i] = ax[last];
+			ay[i] = ay[last];
+			age[i] = age[last];
+			inverseLifetime[i] = inverseLifetime[last];
+			startSize[i] = startSize[last];
+			endSize[i] = endSize[last];
+			startColor[i] = startColor[last];
+			endColor[i] = endColor[last];
+		}
+	};
+
+	/**
+	 * @struct	Emitter
+	 *
+	 * @brief	Spawns particles continuously at a world position or at a transformable.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Emitter {
+		/** @brief	The followed transformable, nullptr to emit at position */
+		const sf::Transformable* target;
+
+		/** @brief	The world position, or the offset from the position of target */
+		sf::Vector2f position;
+
+		/** @brief	The spawned particles */
+		ParticleEffect effect;
+
+		/** @brief	Particles per second */
+		float rate;
+
+		/** @brief	Fraction of a particle carried over to the next update */
+		float accumulator;
+
+		/** @brief	False once detached, the slot can be reused */
+		bool active;
+	};
+
+	/** @brief	Capacity of every pool */
+	std::size_t poolCapacity;
+
+	/** @brief	One pool per texture */
+	std::vector<Pool> pools;
+
+	/** @brief	The emitters, indexed by the identifiers returned by ParticleSystem::attach() and ParticleSystem::emit() */
+	std::vector<Emitter> emitters;
+
+	/** @brief	Random source for the spawn properties */
+	std::minstd_rand random;
+
+	/**
+	 * @fn	float ParticleSystem::randomBetween(float min, float max)
+	 *
+	 * @brief	Gets a uniformly distributed random value
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	min	The minimum.
+	 * @param	max	The maximum.
+	 *
+	 * @return	A value between min and max.
+	 */
+
+	float randomBetween(float min, float max) {
+		return min + (max - min) * std::uniform_real_distribution<float>(0.0f, 1.0f)(random);
+	}
+
+	/**
+	 * @fn	Pool& ParticleSystem::getPool(const sf::Texture* texture)
+	 *
+	 * @brief	Gets the pool of texture, creating it when it does not exist
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	texture	The texture, may be nullptr.
+	 *
+	 * @return	The pool.
+	 */
+
+	Pool& getPool(const sf::Texture* texture) {
+		for (Pool& pool : pools) {
+			if (pool.texture == texture) {
+				return pool;
+			}
+		}
+
+		pools.emplace_back(texture, poolCapacity);
+		return pools.back();
+	}
+
+	/**
+	 * @fn	void ParticleSystem::spawn(Pool& pool, const ParticleEffect& effect, sf::Vector2f position, std::size_t amount)
+	 *
+	 * @brief	Spawns particles at position, dropping the ones that do not fit in pool
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	pool		The pool of the texture of effect.
+	 * @param 		  	effect  	The effect.
+	 * @param 		  	position	The world position.
+	 * @param 		  	amount  	Amount of particles.
+	 */
+
+	void spawn(Pool& pool, const ParticleEffect& effect, sf::Vector2f position, std::size_t amount) {
+		const float degreesToRadians = 3.14159265f / 180.0f;
+		const std::size_t end = std::min(pool.count + amount, pool.capacity());
+
+		for (std::size_t i = pool.count; i < end; i++) {
+			const float angle = (effect.direction + randomBetween(-0.5f, 0.5f) * effect.spread) * degreesToRadians;
+			const float speed = randomBetween(effect.minSpeed, effect.maxSpeed);
+
+			pool.x[i] = position.x;
+			pool.y[i] = position.y;
+			pool.vx[i] = std::cos(angle) * speed;
+			pool.vy[i] = std::sin(angle) * speed;
+			pool.ax[i] = effect.acceleration.x;
+			pool.ay[i] = effect.acceleration.y;
+			pool.age[i] = 0.0f;
+			pool.inverseLifetime[i] = 1.0f / std::max(0.001f, randomBetween(effect.minLifetime, effect.maxLifetime));
+			pool.startSize[i] = effect.startSize;
+			pool.endSize[i] = effect.endSize;
+			pool.startColor[i] = effect.startColor;
+			pool.endColor[i] = effect.endColor;
+		}
+
+		pool.count = end;
+	}
+
+	/**
+	 * @fn	static void ParticleSystem::simulate(Pool& pool, float elapsedTime)
+	 *
+	 * @brief	Advances the particles in pool and removes the ones that have reached the end of their lifetime
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	pool	   	The pool.
+	 * @param 		  	elapsedTime	The elapsed time in seconds.
+	 */
+
+	static void simulate(Pool& pool, float elapsedTime) {
+		const std::size_t count = pool.count;
+
+		float* x = pool.x.data();
+		float* y = pool.y.data();
+		float* vx = pool.vx.data();
+		float* vy = pool.vy.data();
+		const float* ax = pool.ax.data();
+		const float* ay = pool.ay.data();
+		float* age = pool.age.data();
+
+		// Independent loops over plain arrays, so each of them compiles to vector instructions.
+		for (std::size_t i = 0; i < count; i++) {
+			vx[i] += ax[i] * elapsedTime;
+			vy[i] += ay[i] * elapsedTime;
+		}
+
+		for (std::size_t i = 0; i < count; i++) {
+			x[i] += vx[i] * elapsedTime;
+			y[i] += vy[i] * elapsedTime;
+		}
+
+		for (std::size_t i = 0; i < count; i++) {
+			age[i] += elapsedTime;
+		}
+
+		for (std::size_t i = 0; i < pool.count;) {
+			if (pool.age[i] * pool.inverseLifetime[i] >= 1.0f) {
+				pool.kill(i);
+			}
+			else {
+				i++;
+			}
+		}
+	}
+
+	/**
+	 * @fn	static sf::Uint8 ParticleSystem::mix(sf::Uint8 from, sf::Uint8 to, float t)
+	 *
+	 * @brief	Interpolates between two color components
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	from	The component at t = 0.
+	 * @param	to  	The component at t = 1.
+	 * @param	t   	The progress.
+	 *
+	 * @return	The interpolated component.
+	 */
+
+	static sf::Uint8 mix(sf::Uint8 from, sf::Uint8 to, float t) {
+		return static_cast<sf::Uint8>(from + (to - from) * t);
+	}
+
+	/**
+	 * @fn	static void ParticleSystem::buildVertices(Pool& pool)
+	 *
+	 * @brief	Writes a quad for every live particle of pool into its vertex array
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	pool	The pool.
+	 */
+
+	static void buildVertices(Pool& pool) {
+		sf::Vector2f textureSize;
+
+		if (pool.texture != nullptr) {
+			textureSize = sf::Vector2f(pool.texture->getSize());
+		}
+
+		for (std::size_t i = 0; i < pool.count; i++) {
+			const float t = pool.age[i] * pool.inverseLifetime[i];
+			const float half = (pool.startSize[i] + (pool.endSize[i] - pool.startSize[i]) * t) / 2.0f;
+			const sf::Color& from = pool.startColor[i];
+			const sf::Color& to = pool.endColor[i];
+			const sf::Color color(mix(from.r, to.r, t), mix(from.g, to.g, t), mix(from.b, to.b, t), mix(from.a, to.a, t));
+
+			sf::Vertex* quad = &pool.vertices[i * 4];
+
+			quad[0] = sf::Vertex({ pool.x[i] - half, pool.y[i] - half }, color, { 0, 0 });
+			quad[1] = sf::Vertex({ pool.x[i] + half, pool.y[i] - half }, color, { textureSize.x, 0 });
+			quad[2] = sf::Vertex({ pool.x[i] + half, pool.y[i] + half }, color, textureSize);
+			quad[3] = sf::Vertex({ pool.x[i] - half, pool.y[i] + half }, color, { 0, textureSize.y });
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	ParticleSystem::ParticleSystem(std::size_t poolCapacity = 16384)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	poolCapacity	(Optional) Maximum amount of live particles per texture.
+	 */
+
+	ParticleSystem(std::size_t poolCapacity = 16384) : poolCapacity(poolCapacity) { }
+
+	/**
+	 * @fn	void ParticleSystem::burst(const ParticleEffect& effect, sf::Vector2f position, std::size_t amount)
+	 *
+	 * @brief	Spawns amount particles at once
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	effect  	The effect.
+	 * @param	position	The world position.
+	 * @param	amount  	Amount of particles.
+	 */
+
+	void burst(const ParticleEffect& effect, sf::Vector2f position, std::size_t amount) {
+		spawn(getPool(effect.texture), effect, position, amount);
+	}
+
+	/**
+	 * @fn	std::size_t ParticleSystem::emit(const ParticleEffect& effect, sf::Vector2f position, float rate)
+	 *
+	 * @brief	Adds an emitter at a world position
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	effect  	The effect.
+	 * @param	position	The world position.
+	 * @param	rate		Particles per second.
+	 *
+	 * @return	Identifier of the emitter, to be passed to ParticleSystem::detach().
+	 */
+
+	std::size_t emit(const ParticleEffect& effect, sf::Vector2f position, float rate) {
+		for (std::size_t i = 0; i < emitters.size(); i++) {
+			if (!emitters[i].active) {
+				emitters[i] = { nullptr, position, effect, rate, 0.0f, true };
+				return i;
+			}
+		}
+
+		emitters.push_back({ nullptr, position, effect, rate, 0.0f, true });
+		return emitters.size() - 1;
+	}
+
+	/**
+	 * @fn	std::size_t ParticleSystem::attach(const sf::Transformable& target, const ParticleEffect& effect, float rate, sf::Vector2f offset = {})
+	 *
+	 * @brief	Adds an emitter that follows target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	target	The followed transformable, has to outlive the emitter.
+	 * @param	effect	The effect.
+	 * @param	rate  	Particles per second.
+	 * @param	offset	(Optional) Offset from the position of target.
+	 *
+	 * @return	Identifier of the emitter, to be passed to ParticleSystem::detach().
+	 */
+
+	std::size_t attach(const sf::Transformable& target, const ParticleEffect& effect, float rate, sf::Vector2f offset = {}) {
+		const std::size_t id = emit(effect, offset, rate);
+		emitters[id].target = &target;
+		return id;
+	}
+
+	/**
+	 * @fn	void ParticleSystem::detach(std::size_t id)
+	 *
+	 * @brief	Removes an emitter, its live particles fade out as usual
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	Identifier of the emitter.
+	 */
+
+	void detach(std::size_t id) {
+		if (id < emitters.size()) {
+			emitters[id].active = false;
+			emitters[id].target = nullptr;
+		}
+	}
+
+	/**
+	 * @fn	void ParticleSystem::clear()
+	 *
+	 * @brief	Removes every particle and emitter, keeping the pools allocated
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		for (Pool& pool : pools) {
+			pool.count = 0;
+		}
+
+		emitters.clear();
+	}
+
+	/**
+	 * @fn	void ParticleSystem::clearParticles()
+	 *
+	 * @brief	Removes every particle, the emitters keep emitting
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clearParticles() {
+		for (Pool& pool : pools) {
+			pool.count = 0;
+		}
+	}
+
+	/**
+	 * @fn	void ParticleSystem::update(float elapsedTime)
+	 *
+	 * @brief	Spawns the particles of the emitters, advances every particle and rebuilds the vertices
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	elapsedTime	The elapsed time in seconds.
+	 */
+
+	void update(float elapsedTime) {
+		for (Emitter& emitter : emitters) {
+			if (!emitter.active) {
+				continue;
+			}
+
+			emitter.accumulator += emitter.rate * elapsedTime;
+
+			const std::size_t amount = static_cast<std::size_t>(emitter.accumulator);
+			emitter.accumulator -= amount;
+
+			if (amount > 0) {
+				const sf::Vector2f position = emitter.target != nullptr ? emitter.target->getPosition() + emitter.position : emitter.position;
+				spawn(getPool(emitter.effect.texture), emitter.effect, position, amount);
+			}
+		}
+
+		for (Pool& pool : pools) {
+			simulate(pool, elapsedTime);
+			buildVertices(pool);
+		}
+	}
+
+	/**
+	 * @fn	std::size_t ParticleSystem::getParticleCount() const
+	 *
+	 * @brief	Gets the amount of live particles
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The amount of live particles over all pools.
+	 */
+
+	std::size_t getParticleCount() const {
+		std::size_t count = 0;
+
+		for (const Pool& pool : pools) {
+			count += pool.count;
+		}
+
+		return count;
+	}
+
+	/**
+	 * @fn	void ParticleSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const override
+	 *
+	 * @brief	Draws the particles
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The render target.
+	 * @param 		  	states	The render states.
+	 */
+
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override {
+		RenderList::drawTo(target, *this, states);
+	}
+
+	/**
+	 * @fn	void ParticleSystem::draw(RenderList& renderList, sf::RenderStates states) const override
+	 *
+	 * @brief	Records the particles as one command per texture
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	renderList	The render list.
+	 * @param 		  	states	  	The render states.
+	 */
+
+	void draw(RenderList& renderList, sf::RenderStates states) const override {
+		for (const Pool& pool : pools) {
+			if (pool.count > 0) {
+				states.texture = pool.texture;
+				renderList.draw(&pool.vertices[0], pool.count * 4, sf::Quads, states);
+			}
+		}
+	}
+};
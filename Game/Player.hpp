@@ -8,8 +8,13 @@
 #include "EventSource.hpp"
 #include "Keyboard.hpp"
 #include "KeyScheme.hpp"
+#include "ActionMap.hpp"
 #include "Label.hpp"
 #include "KeyToString.hpp"
+#include "AnimationSystem.hpp"
+#include "TextureAtlas.hpp"
+#include "RenderList.hpp"
+#include "Renderable.hpp"
 #include "VectorStreamOperators.hpp"
 
 /**
@@ -21,11 +26,11 @@
  * @date	25-1-2018
  */
 
-class Player : public Body {
+class Player : public Body, public Renderable {
 private:
 
-    /** @brief	The window */
-    sf::RenderWindow &window;
+    /** @brief	The render list the key scheme is displayed on */
+    RenderList &renderList;
 
 	EventSource<sf::Keyboard::Key> keyPressed;
 	EventSource<sf::Keyboard::Key> keyReleased;
@@ -45,6 +50,9 @@ private:
 	/** @brief	Zero-based index of the key scheme */
 	unsigned int keySchemeIndex = 0;
 
+	/** @brief	The actions of the active key scheme */
+	ActionMap actions;
+
 	/** @brief	True if key scheme update ready */
 	bool keySchemeUpdateReady = false;
 
@@ -69,8 +77,8 @@ private:
 	/** @brief	The running speed */
 	float runningSpeed = 200;
 
-	/** @brief	The running animation time in miliseconds */
-	int runningAnimationTimeInMiliseconds = 25;
+	/** @brief	The animation speed factor while running */
+	float runningAnimationSpeed = 2;
 
     /** @brief	The run clock */
     sf::Clock runClock;
@@ -99,33 +107,100 @@ private:
     bool leftArmDraw = true;
     bool rightArmDraw = true;
     bool rollRectangleDisplay = false;
-    /** @brief	The torso */
-    Body torso;
-    /** @brief	The left leg */
-    Body leftLeg;
-    /** @brief	The right leg */
-    Body rightLeg;
-    /** @brief	The head */
-    Body head;
-    /** @brief	The left arm */
-    Body leftArm;
-    /** @brief	The right arm */
-    Body rightArm;
-    /** @brief	The roll rectangle */
-    Body rollRectangle;
+
+	/**
+	 * @enum	Part
+	 *
+	 * @brief	The parts of the player mesh, in draw order.
+	 */
+
+	enum Part {
+		Head,
+		Torso,
+		LeftLeg,
+		RightLeg,
+		LeftArm,
+		RightArm,
+		RollRectangle,
+		PartCount
+	};
+
+	/**
+	 * @struct	PartDescriptor
+	 *
+	 * @brief	A quad of the player mesh, centered on the player.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct PartDescriptor {
+		/** @brief	The size of the quad */
+		sf::Vector2f size;
+		/** @brief	The texture coordinates in the atlas */
+		sf::IntRect uv;
+		/** @brief	True if the quad is part of the mesh */
+		bool visible = false;
+	};
+
+	/** @brief	The body parts */
+	std::array<PartDescriptor, PartCount> parts;
+
+	/** @brief	Atlas of all textures the body parts can show */
+	TextureAtlas atlas;
+
+	/** @brief	Quads of the visible body parts, drawn in a single call */
+	sf::VertexArray mesh = sf::VertexArray(sf::Quads);
 
 	int bodyPartsLeft = 5;
 	/** @brief	The playersize */
     sf::Vector2f playersize = {20,40};
 
-    /** @brief	The default animation time in miliseconds */
-    int defaultAnimationTimeInMiliseconds = 50;
-    /** @brief	The animation time in miliseconds */
-    int animationTimeInMiliseconds = defaultAnimationTimeInMiliseconds;
-	/** @brief	The animation cyle */
-	int animationCyle = 0;
-    /** @brief	The animation clock */
-    sf::Clock animationClock;
+	/** @brief	The animation speed factor */
+	float animationSpeed = 1;
+
+	/**
+	 * @struct	AnimatedPart
+	 *
+	 * @brief	A body part with its clips for standing, walking right and walking left.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct AnimatedPart {
+		/** @brief	The body part */
+		Part part;
+		/** @brief	True while the body part is displayed */
+		const bool* display;
+		/** @brief	Name of the body part in the clip identifiers */
+		const char* name;
+		/** @brief	The animation identifier in the AnimationSystem */
+		std::size_t animation = 0;
+		/** @brief	Clips per walk state, nullptr keeps the current frame */
+		std::array<const AnimationClip*, 3> clips = {};
+
+		/**
+		 * @fn	AnimatedPart(Part part, const bool* display, const char* name)
+		 *
+		 * @brief	Constructor, the animation and clips are assigned by Player::setAnimations()
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param	part   	The body part.
+		 * @param	display	True while the body part is displayed.
+		 * @param	name   	Name of the body part in the clip identifiers.
+		 */
+
+		AnimatedPart(Part part, const bool* display, const char* name) : part(part), display(display), name(name) { }
+	};
+
+	/** @brief	The animated body parts */
+	std::vector<AnimatedPart> animatedParts;
+
+	/** @brief	The animation system animating the body parts, nullptr if not animated */
+	AnimationSystem* animations = nullptr;
 
     /** @brief	The keyscheme text */
     Label keyschemeText;
@@ -145,19 +220,24 @@ public:
 	 * @author	Wiebe
 	 * @date	25-1-2018
 	 */
-	Player(sf::RenderWindow &window) : window(window) {
+	Player(RenderList &renderList) : renderList(renderList) {
         setSize(playersize);
 		
         setFillColor(sf::Color::Transparent);
-        torso.setSize(playersize);
-        head.setSize(playersize);
-        leftLeg.setSize(playersize);
-        rightLeg.setSize(playersize);
-        leftArm.setSize(playersize);
-        rightArm.setSize(playersize);
-        rollRectangle.setSize({20,20});
+
+		for (PartDescriptor& part : parts) {
+			part.size = playersize;
+		}
+
+		parts[RollRectangle].size = { 20, 20 };
+
+		actions.setScheme(keySchemes[keySchemeIndex]);
 	}
 
+	// The animations registered by Player::setAnimations() refer to the player, so it cannot be copied or moved.
+	Player(const Player&) = delete;
+	Player& operator=(const Player&) = delete;
+
 	/**
 	 * @fn	void Player::connect()
 	 *
@@ -188,6 +268,21 @@ public:
 		}
 	}
 
+	/**
+	 * @fn	void Player::sample(const KeyboardState& state)
+	 *
+	 * @brief	Samples the keys of the active key scheme for the next update
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	state	The keyboard state of the current tick.
+	 */
+
+	void sample(const KeyboardState& state) {
+		actions.update(state);
+	}
+
 	/**
 	 * @fn	void Player::readInput()
 	 *
@@ -200,29 +295,29 @@ public:
 	void readInput() {
 		walkDirection = 0;
 
-		if (keySchemes[keySchemeIndex].jumpPressed) {
+		if (actions.isDown(PlayerAction::Jump)) {
 			doJump();
 		}
 
-		if (keySchemes[keySchemeIndex].moveRightPressed) {
+		if (actions.isDown(PlayerAction::MoveRight)) {
 			walkDirection++;
 		}
 
-		if (keySchemes[keySchemeIndex].moveLeftPressed) {
+		if (actions.isDown(PlayerAction::MoveLeft)) {
 			walkDirection--;
 		}
 
-		if (keySchemes[keySchemeIndex].rollPressed && !roll) {
+		if (actions.isDown(PlayerAction::Roll) && !roll) {
 			roll = true;
 			rollClock.restart();
 		}
 
-		if (keySchemes[keySchemeIndex].runPressed) {
-			animationTimeInMiliseconds = runningAnimationTimeInMiliseconds;
+		if (actions.isDown(PlayerAction::Run)) {
+			animationSpeed = runningAnimationSpeed;
 			walkspeed = runningSpeed;
 		}
 		else {
-			animationTimeInMiliseconds = defaultAnimationTimeInMiliseconds;
+			animationSpeed = 1;
 			walkspeed = defaultWalkingSpeed;
 		}
 	}
@@ -251,12 +346,7 @@ public:
 		checkDeath();
 
 		Body::update(elapsedTime);
-        torso.setPosition(getPosition());
-        leftLeg.setPosition(getPosition());
-        rightLeg.setPosition(getPosition());
-        leftArm.setPosition(getPosition());
-        rightArm.setPosition(getPosition());
-        head.setPosition(getPosition());
+		updateMesh();
 	}
 
 	/**
@@ -377,119 +467,166 @@ public:
 	 */
 
 	void setNextKeyScheme() {
-		if (keySchemes.size() >= keySchemeIndex + 1) {
+		if (keySchemeIndex + 1 < keySchemes.size()) {
 			keySchemeIndex++;
+			actions.setScheme(keySchemes[keySchemeIndex]);
 			showKeySchemeUsed();
 		}
 	}
 
 	void setPrevKeyScheme() {
-		if (keySchemeIndex - 1 >= 0) {
+		if (keySchemeIndex > 0) {
 			keySchemeIndex--;
+			actions.setScheme(keySchemes[keySchemeIndex]);
 			showKeySchemeUsed();
 		}
 	}
 
 
+	/**
+	 * @fn	void Player::setAnimations(AnimationSystem& system, const AnimationLibrary& library)
+	 *
+	 * @brief	Animates the body parts with system using the "fimmy-{state}-{part}" clips from library,
+	 * 			where state is idle, walk-right or walk-left and part is the name of the body part member
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	system 	The animation system, must outlive the player.
+	 * @param 		  	library	The clip library, must outlive the player.
+	 */
+
+	void setAnimations(AnimationSystem& system, const AnimationLibrary& library) {
+		const std::array<std::string, 3> states = { "idle", "walk-right", "walk-left" };
+		std::vector<std::string> textureIds = { "fimmyRollRight", "fimmyRollLeft", "fimmyRollRightHeadless" };
+
+		animations = &system;
+		animatedParts = {
+			{ Torso, &torsoDisplay, "torso" },
+			{ Head, &headDisplay, "head" },
+			{ LeftLeg, &leftLegDisplay, "leftLeg" },
+			{ RightLeg, &rightLegDisplay, "rightLeg" },
+			{ LeftArm, &leftArmDisplay, "leftArm" },
+			{ RightArm, &rightArmDisplay, "rightArm" }
+		};
+
+		for (AnimatedPart& animatedPart : animatedParts) {
+			const Part part = animatedPart.part;
+
+			animatedPart.animation = system.add([this, part](const AnimationFrame& frame) {
+				setPartFrame(part, frame);
+			});
+
+			for (std::size_t state = 0; state < states.size(); state++) {
+				animatedPart.clips[state] = library.find("fimmy-" + states[state] + "-" + animatedPart.name);
+
+				if (animatedPart.clips[state] != nullptr) {
+					for (const AnimationFrame& frame : animatedPart.clips[state]->frames) {
+						textureIds.push_back(frame.textureId);
+					}
+				}
+			}
+		}
+
+		atlas.build(textureIds);
+	}
+
+	/**
+	 * @fn	void Player::setPartFrame(Part part, const AnimationFrame& frame)
+	 *
+	 * @brief	Shows an animation frame on a body part
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	part 	The body part.
+	 * @param	frame	The frame, its texture has to be in the atlas.
+	 */
+
+	void setPartFrame(Part part, const AnimationFrame& frame) {
+		const sf::IntRect* region = atlas.find(frame.textureId);
+
+		if (region != nullptr) {
+			if (frame.wholeTexture) {
+				parts[part].uv = *region;
+			}
+			else {
+				parts[part].uv = sf::IntRect(region->left + frame.rect.left, region->top + frame.rect.top, frame.rect.width, frame.rect.height);
+			}
+		}
+	}
+
+	/**
+	 * @fn	void Player::updateMesh()
+	 *
+	 * @brief	Rebuilds the mesh from the visible body parts
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void updateMesh() {
+		parts[Head].visible = !roll && headDisplay;
+		parts[Torso].visible = !roll && torsoDisplay;
+		parts[LeftLeg].visible = !roll && leftLegDisplay;
+		parts[RightLeg].visible = !roll && rightLegDisplay;
+		parts[LeftArm].visible = !roll && leftArmDraw;
+		parts[RightArm].visible = !roll && rightArmDraw;
+		parts[RollRectangle].visible = roll && rollRectangleDisplay;
+
+		mesh.clear();
+
+		for (const PartDescriptor& part : parts) {
+			if (part.visible && part.uv.width != 0) {
+				const sf::Vector2f half = part.size / 2.0f;
+				const sf::FloatRect uv = static_cast<sf::FloatRect>(part.uv);
+
+				mesh.append(sf::Vertex({ -half.x, -half.y }, { uv.left, uv.top }));
+				mesh.append(sf::Vertex({ half.x, -half.y }, { uv.left + uv.width, uv.top }));
+				mesh.append(sf::Vertex({ half.x, half.y }, { uv.left + uv.width, uv.top + uv.height }));
+				mesh.append(sf::Vertex({ -half.x, half.y }, { uv.left, uv.top + uv.height }));
+			}
+		}
+	}
+
     /**
      * @fn	void Player::doWalk()
      *
-     * @brief	Executes the walk operation
+     * @brief	Executes the walk operation, playing the clips of the walk direction on the displayed body parts
      *
      * @author	Jeffrey
      * @date	1/31/2018
      */
 
     void doWalk(){
-        if (walkDirection == 0){
-            if (!roll) {
-                if (torsoDisplay) {
-                    torso.setTexture(&AssetManager::instance()->getTexture("fimmyStandingBody"));
-                }
-                if (headDisplay) {
-                    head.setTexture(&AssetManager::instance()->getTexture("fimmyStandingHead"));
-                }
-                if (leftLegDisplay) {
-                    leftLeg.setTexture(&AssetManager::instance()->getTexture("fimmyStandingLeftLeg"));
-                }
-                if (rightLegDisplay) {
-                    rightLeg.setTexture(&AssetManager::instance()->getTexture("fimmyStandingRightLeg"));
+        if (!roll) {
+            const std::size_t state = walkDirection > 0 ? 1 : walkDirection < 0 ? 2 : 0;
+
+            if (animations != nullptr) {
+                for (const AnimatedPart& part : animatedParts) {
+                    if (*part.display && part.clips[state] != nullptr) {
+                        animations->play(part.animation, *part.clips[state]);
+                        animations->setSpeed(part.animation, animationSpeed);
+                    }
                 }
+            }
+
+            if (walkDirection == 0) {
                 if (leftArmDisplay) {
-                    leftArm.setTexture(&AssetManager::instance()->getTexture("fimmyStandingLeftArm"));
-                    leftArmDraw =true;
+                    leftArmDraw = true;
                 }
                 if (rightArmDisplay) {
-                    rightArm.setTexture(&AssetManager::instance()->getTexture("fimmyStandingRightArm"));
                     rightArmDraw = true;
                 }
             }
-        }
-        if (walkDirection != 0) {
-            if (walkDirection > 0) {
-                if (!roll) {
-                    if (torsoDisplay) {
-                        torso.setTexture(&AssetManager::instance()->getTexture("fimmyRightBody"));
-                    }
-                    if (headDisplay) {
-                        head.setTexture(&AssetManager::instance()->getTexture("fimmyRightHead"));
-                    }
-                    if (rightLegDisplay) {
-                        if (animationClock.getElapsedTime().asMilliseconds() > animationTimeInMiliseconds) {
-                            switch (animationCyle) {
-                                case 1:
-                                    rightLeg.setTexture(&AssetManager::instance()->getTexture("fimmyRightLeg"));
-                                    break;
-                                case 2:
-                                    rightLeg.setTexture(&AssetManager::instance()->getTexture("fimmyRightLeg2"));
-                                    break;
-                                case 3:
-                                    rightLeg.setTexture(&AssetManager::instance()->getTexture("fimmyRightLeg3"));
-                                    animationCyle = 0;
-                                    break;
-                            }
-                            animationClock.restart();
-                            animationCyle++;
-                        }
-                    }
-                    if (rightArmDisplay) {
-                        rightArm.setTexture(&AssetManager::instance()->getTexture("fimmyRightArm"));
-                    }
-					leftArmDraw = false;
-                }
+            else if (walkDirection > 0) {
+                leftArmDraw = false;
             }
-            if (walkDirection < 0) {
-                if (!roll) {
-                    if (torsoDisplay) {
-                        torso.setTexture(&AssetManager::instance()->getTexture("fimmyLeftBody"));
-					}
-                    if (headDisplay) {
-                        head.setTexture(&AssetManager::instance()->getTexture("fimmyLeftHead"));
-                    }
-                    if (leftLegDisplay) {
-                        if (animationClock.getElapsedTime().asMilliseconds() > animationTimeInMiliseconds) {
-                            switch (animationCyle) {
-                                case 1:
-                                    leftLeg.setTexture(&AssetManager::instance()->getTexture("fimmyLeftLeg"));
-                                    break;
-                                case 2:
-                                    leftLeg.setTexture(&AssetManager::instance()->getTexture("fimmyLeftLeg2"));
-                                    break;
-                                case 3:
-                                    leftLeg.setTexture(&AssetManager::instance()->getTexture("fimmyLeftLeg3"));
-                                    animationCyle = 0;
-                                    break;
-                            }
-                            animationClock.restart();
-                            animationCyle++;
-                        }
-                    }
-                    if (leftArmDisplay) {
-                        leftArm.setTexture(&AssetManager::instance()->getTexture("fimmyLeftArm"));
-                    }
-                    rightArmDraw = false;
-                }
+            else {
+                rightArmDraw = false;
             }
+        }
+        if (walkDirection != 0) {
             if (!roll) {
                 setVelocity({ walkDirection * walkspeed, getVelocity().y });
             }
@@ -512,23 +649,21 @@ public:
 	void doRoll(){
         rollRectangleDisplay = true;
 		if (walkDirection > 0) {
-			rollRectangle.setPosition(getPosition());
 			if (headDisplay) {
-				rollRectangle.setTexture(&AssetManager::instance()->getTexture("fimmyRollRight"));
+				setPartFrame(RollRectangle, { "fimmyRollRight", sf::IntRect(), true });
 			}
 			else {
-				rollRectangle.setTexture(&AssetManager::instance()->getTexture("fimmyRollRightHeadless"));
+				setPartFrame(RollRectangle, { "fimmyRollRightHeadless", sf::IntRect(), true });
 			}
 			setVelocity({ 299, jumpForce });
 		}
 		else if (walkDirection < 0) {
 			setVelocity({ -299, jumpForce });
-			rollRectangle.setPosition(getPosition());
 			if (headDisplay) {
-				rollRectangle.setTexture(&AssetManager::instance()->getTexture("fimmyRollLeft"));
+				setPartFrame(RollRectangle, { "fimmyRollLeft", sf::IntRect(), true });
 			}
 			else {
-				rollRectangle.setTexture(&AssetManager::instance()->getTexture("fimmyRollRightHeadless"));
+				setPartFrame(RollRectangle, { "fimmyRollRightHeadless", sf::IntRect(), true });
 			}
 		}
 		else {
@@ -582,9 +717,9 @@ public:
      */
 
     void updateKeySchemeDisplay(){
-        sf::Vector2f position = window.mapPixelToCoords(static_cast<sf::Vector2i>(window.getView().getSize()), window.getView());
+        sf::Vector2f position = renderList.mapPixelToCoords(static_cast<sf::Vector2i>(renderList.getView().getSize()), renderList.getView());
 		sf::Vector2f offset;
-		if (window.getSize().y > 1000) {
+		if (renderList.getSize().y > 1000) {
 			offset = { -20, 500 };
 		}
 		else {
@@ -595,13 +730,13 @@ public:
         if(keySchemeShowClock.getElapsedTime().asMilliseconds() > keySchemeShowTimeInMilliseconds){
             keyschemeText.setColor(sf::Color::Transparent);
         }
-		window.draw(keyschemeText);
+		renderList.draw(keyschemeText);
     }
 
     /**
      * @fn	void Player::draw(sf::RenderTarget &window, sf::RenderStates renderStates) const override
      *
-     * @brief	Draws
+     * @brief	Draws the mesh of the visible body parts in a single draw call
      *
      * @author	Jeffrey de Waal
      * @date	1/31/2018
@@ -611,38 +746,42 @@ public:
      */
 
     void draw(sf::RenderTarget &window, sf::RenderStates renderStates) const override {
-		if (!roll) {
-			if (headDisplay) {
-				window.draw(head);
-			}
+		RenderList::drawTo(window, *this, renderStates);
+    }
 
-			if (torsoDisplay) {
-				window.draw(torso);
-			}
+    /**
+     * @fn	void Player::draw(RenderList &renderList, sf::RenderStates renderStates) const override
+     *
+     * @brief	Records the mesh of the visible body parts as a single command
+     *
+     * @author	Julian
+     * @date	2026-10-19
+     *
+     * @param [in,out]	target			The render list.
+     * @param 		  	renderStates	List of states.
+     */
 
-			if (leftLegDisplay) {
-				window.draw(leftLeg);
-			}
+    void draw(RenderList &target, sf::RenderStates renderStates) const override {
+		renderStates.transform.translate(getPosition());
+		renderStates.texture = &atlas.getTexture();
 
-			if (rightLegDisplay) {
-				window.draw(rightLeg);
-			}
-			
-            if (leftArmDraw) {
-				window.draw(leftArm);
-            }
+		target.draw(mesh, renderStates);
+    }
 
-            if (rightArmDraw) {
-				window.draw(rightArm);
-            }
-		}
-		else {
-			if (rollRectangleDisplay) {
-				window.draw(rollRectangle);
-			}
-		}
+	/**
+	 * @fn	const sf::Texture* Player::getBatchTexture() const override
+	 *
+	 * @brief	Gets the atlas the mesh is drawn with
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The atlas texture.
+	 */
 
-    }
+	const sf::Texture* getBatchTexture() const override {
+		return &atlas.getTexture();
+	}
 
 	/**
 	 * @fn	void Player::loseLeftLeg()
@@ -817,4 +956,91 @@ public:
 		else { return; }
 		setPrevKeyScheme();
 	}
+
+	/**
+	 * @struct	Snapshot
+	 *
+	 * @brief	The state of the player that changes while playing, restored with Player::restore().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Snapshot {
+		/** @brief	Position, velocity and size */
+		Body::Snapshot body;
+		/** @brief	The walk direction */
+		int32_t walkDirection;
+		/** @brief	Index of the active key scheme */
+		unsigned int keySchemeIndex;
+		/** @brief	Amount of body parts that can still be lost */
+		int bodyPartsLeft;
+		/** @brief	True if a jump is pending */
+		bool jump;
+		/** @brief	True while rolling */
+		bool roll;
+		/** @brief	Displayed body parts */
+		bool torsoDisplay, leftLegDisplay, rightLegDisplay, headDisplay, leftArmDisplay, rightArmDisplay;
+		/** @brief	Drawn arms */
+		bool leftArmDraw, rightArmDraw;
+		/** @brief	True while the roll rectangle is displayed */
+		bool rollRectangleDisplay;
+		/** @brief	Always false, fills the last word so the snapshot has no padding bytes */
+		bool unused;
+	};
+
+	static_assert(sizeof(Snapshot) == sizeof(Body::Snapshot) + 3 * 4 + 12, "Player::Snapshot must not contain padding bytes");
+
+	/**
+	 * @fn	Snapshot Player::getSnapshot() const
+	 *
+	 * @brief	Captures the state of the player
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The snapshot.
+	 */
+
+	Snapshot getSnapshot() const {
+		return {
+			Body::getSnapshot(), walkDirection, keySchemeIndex, bodyPartsLeft, jump, roll,
+			torsoDisplay, leftLegDisplay, rightLegDisplay, headDisplay, leftArmDisplay, rightArmDisplay,
+			leftArmDraw, rightArmDraw, rollRectangleDisplay, false
+		};
+	}
+
+	/**
+	 * @fn	void Player::restore(const Snapshot& snapshot)
+	 *
+	 * @brief	Restores the state captured by Player::getSnapshot() and hides the key scheme
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	snapshot	The snapshot.
+	 */
+
+	void restore(const Snapshot& snapshot) {
+		Body::restore(snapshot.body);
+
+		walkDirection = snapshot.walkDirection;
+		keySchemeIndex = snapshot.keySchemeIndex;
+		actions.setScheme(keySchemes[keySchemeIndex]);
+		bodyPartsLeft = snapshot.bodyPartsLeft;
+		jump = snapshot.jump;
+		roll = snapshot.roll;
+		torsoDisplay = snapshot.torsoDisplay;
+		leftLegDisplay = snapshot.leftLegDisplay;
+		rightLegDisplay = snapshot.rightLegDisplay;
+		headDisplay = snapshot.headDisplay;
+		leftArmDisplay = snapshot.leftArmDisplay;
+		rightArmDisplay = snapshot.rightArmDisplay;
+		leftArmDraw = snapshot.leftArmDraw;
+		rightArmDraw = snapshot.rightArmDraw;
+		rollRectangleDisplay = snapshot.rollRectangleDisplay;
+
+		keyschemeText.setText("");
+		updateMesh();
+	}
 };
\ No newline at end of file
@@ -23,9 +23,12 @@ class PowerUp : public Body {
 		if (!used) {
 			used = true;
 			apply(player);
+			applied.fire(player);
 		}
 	}
 public:
+	/** @brief	Fired after the power-up has been applied to the player */
+	EventSource<Player&> applied;
 
 	/**
 	 * @fn	PowerUp::PowerUp(IntersectionGroup* powerUpIntersectionGroup)
@@ -54,6 +57,36 @@ public:
 
 	virtual void apply(Player& player) const = 0;
 
+	/**
+	 * @fn	bool PowerUp::isUsed() const
+	 *
+	 * @brief	Query if the power-up has been applied
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if used.
+	 */
+
+	bool isUsed() const {
+		return used;
+	}
+
+	/**
+	 * @fn	void PowerUp::setUsed(bool used)
+	 *
+	 * @brief	Marks the power-up as applied or available, for instance when restarting a level
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	used	False to make the power-up available again.
+	 */
+
+	void setUsed(bool used) {
+		this->used = used;
+	}
+
 	/**
 	 * @fn	void PowerUp::connect(Player& player, Map& map)
 	 *
@@ -68,9 +101,12 @@ public:
 
 	void connect(Player& player, Map& map) {
 		collidedConn = collided.connect([&](Collidable& other) {
-			_apply(player);
+			if (!used) {
+				_apply(player);
 
-			map.eraseDrawable(*this);
+				// Only the drawable is erased, restarting the level shows the power-up again.
+				map.eraseDrawable(*this);
+			}
 		});
 	}
 
@@ -0,0 +1,904 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <exception>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <mutex>
+
+#include "Renderable.hpp"
+#include "DynamicResolution.hpp"
+
+/**
+ * @class	UnsupportedDrawableException
+ *
+ * @brief	Exception for signalling that a drawable can not be recorded into a RenderList.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class UnsupportedDrawableException : public std::exception {
+private:
+	/** @brief	The message */
+	std::string msg;
+
+public:
+
+	/**
+	 * @fn	UnsupportedDrawableException::UnsupportedDrawableException()
+	 *
+	 * @brief	Default constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	UnsupportedDrawableException() : msg("Drawable can not be recorded into a RenderList, implement Renderable for it.") {};
+
+	/**
+	 * @fn	const char* UnsupportedDrawableException::what() const noexcept
+	 *
+	 * @brief	Gets the what
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The message.
+	 */
+
+	const char* what() const noexcept {
+		return msg.c_str();
+	}
+};
+
+/**
+ * @class	RenderList
+ *
+ * @brief	Records the draw calls of a frame, so they can be issued later or on another thread.
+ *
+ * @detailed The simulation draws into a RenderList the same way it would draw into an sf::RenderTarget.
+ * 			 Shapes, sprites and vertex arrays are copied into one vertex buffer, already transformed into world space,
+ * 			 so consecutive primitives with the same texture become a single command. Texts are copied together with
+ * 			 their glyph geometry. sf::Font loads glyphs lazily into its page textures, so every use of a font that may load glyphs
+ * 			 is guarded by RenderList::getGlyphMutex(), including rendering recorded texts on a RenderThread. The recorded RenderList::Frame no longer refers to the objects that were drawn,
+ * 			 only to the textures, fonts and shaders they used, which have to stay alive until it has been rendered.
+ * 			 The view and the mapping between pixels and coordinates are kept by the RenderList, so the simulation
+ * 			 never has to touch the view of the window that the frame is rendered to.
+ * 			 Draws between RenderList::beginDynamicResolution() and RenderList::endDynamicResolution() are rendered
+ * 			 through a DynamicResolution, everything outside of it at native resolution.
+ * 			 @code{.cpp}
+ * 			   renderList.clear();
+ * 			   renderList.setView(camera);
+ * 			   renderList.draw(player);
+ * 			   renderList.render(window);
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class RenderList {
+public:
+
+	/**
+	 * @struct	Command
+	 *
+	 * @brief	A single recorded draw call or view change.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Command {
+		/**
+		 * @enum	Type
+		 *
+		 * @brief	Values that represent command types
+		 */
+
+		enum class Type {
+			View,
+			Vertices,
+			Text,
+			BeginDynamicResolution,
+			EndDynamicResolution
+		};
+
+		/** @brief	The type */
+		Type type;
+
+		/** @brief	Index of the view, first vertex or text */
+		std::size_t index;
+
+		/** @brief	Amount of vertices */
+		std::size_t count;
+
+		/** @brief	Primitive type of the vertices */
+		sf::PrimitiveType primitiveType;
+
+		/** @brief	The render states */
+		sf::RenderStates states;
+	};
+
+	/**
+	 * @class	Frame
+	 *
+	 * @brief	The recorded commands of a frame.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	class Frame {
+		friend class RenderList;
+
+		/** @brief	The commands in draw order */
+		std::vector<Command> commands;
+
+		/** @brief	Vertices of all Vertices commands */
+		std::vector<sf::Vertex> vertices;
+
+		/** @brief	Copies of the drawn texts */
+		std::vector<sf::Text> texts;
+
+		/** @brief	The views set during the frame */
+		std::vector<sf::View> views;
+
+	public:
+
+		/**
+		 * @fn	void RenderList::Frame::clear()
+		 *
+		 * @brief	Removes all commands, keeping the allocated memory
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 */
+
+		void clear() {
+			commands.clear();
+			vertices.clear();
+			texts.clear();
+			views.clear();
+		}
+
+		/**
+		 * @fn	std::size_t RenderList::Frame::getCommandCount() const
+		 *
+		 * @brief	Gets the amount of recorded commands
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The command count.
+		 */
+
+		std::size_t getCommandCount() const {
+			return commands.size();
+		}
+
+		/**
+		 * @fn	void RenderList::Frame::render(sf::RenderTarget& target, DynamicResolution* resolution = nullptr) const
+		 *
+		 * @brief	Issues the recorded commands on target. The view of target is left at the last recorded view.
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @param [in,out]	target	  	The render target.
+		 * @param [in,out]	resolution	(Optional) Renders the dynamic resolution passes, nullptr to render them at native resolution.
+		 */
+
+		void render(sf::RenderTarget& target, DynamicResolution* resolution = nullptr) const {
+			sf::RenderTarget* current = &target;
+			bool scaled = false;
+
+			for (const Command& command : commands) {
+				switch (command.type) {
+				case Command::Type::View:
+					if (scaled) {
+						resolution->setView(views[command.index]);
+					}
+					else {
+						current->setView(views[command.index]);
+					}
+					break;
+				case Command::Type::Vertices:
+					current->draw(&vertices[command.index], command.count, command.primitiveType, command.states);
+					break;
+				case Command::Type::Text: {
+					std::lock_guard<std::mutex> lock(getGlyphMutex());
+					current->draw(texts[command.index], command.states);
+					break;
+				}
+				case Command::Type::BeginDynamicResolution:
+					if (resolution != nullptr) {
+						if (sf::RenderTarget* pass = resolution->begin(target.getSize())) {
+							current = pass;
+							scaled = true;
+						}
+					}
+					break;
+				case Command::Type::EndDynamicResolution:
+					if (scaled) {
+						resolution->end(target);
+						current = &target;
+						scaled = false;
+					}
+					break;
+				}
+			}
+		}
+	};
+
+private:
+	/** @brief	The frame being recorded */
+	Frame frame;
+
+	/** @brief	Size of the target the frame will be rendered to */
+	sf::Vector2u size;
+
+	/** @brief	The default view */
+	sf::View defaultView;
+
+	/** @brief	The current view */
+	sf::View view;
+
+	/** @brief	True if the current view has been recorded into frame */
+	bool viewRecorded = false;
+
+	/**
+	 * @fn	void RenderList::recordView()
+	 *
+	 * @brief	Records the current view if it has changed since the last draw
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void recordView() {
+		if (!viewRecorded) {
+			frame.views.push_back(view);
+			frame.commands.push_back({ Command::Type::View, frame.views.size() - 1, 0, sf::Points, sf::RenderStates::Default });
+			viewRecorded = true;
+		}
+	}
+
+	/**
+	 * @fn	void RenderList::beginVertices(sf::PrimitiveType primitiveType, const sf::RenderStates& states)
+	 *
+	 * @brief	Starts a Vertices command for vertices that are appended next, or continues the previous one if it can be merged
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	primitiveType	The primitive type.
+	 * @param	states		 	The render states, the transform is ignored because vertices are recorded in world space.
+	 */
+
+	void beginVertices(sf::PrimitiveType primitiveType, const sf::RenderStates& states) {
+		recordView();
+
+		// Independent primitives can be appended to the previous command, strips and fans can not.
+		const bool mergeable = primitiveType == sf::Points || primitiveType == sf::Lines || primitiveType == sf::Triangles || primitiveType == sf::Quads;
+
+		if (mergeable && frame.commands.size() > 0) {
+			const Command& previous = frame.commands.back();
+
+			if (previous.type == Command::Type::Vertices && previous.primitiveType == primitiveType &&
+				previous.states.texture == states.texture && previous.states.shader == states.shader && previous.states.blendMode == states.blendMode) {
+				return;
+			}
+		}
+
+		sf::RenderStates worldStates(states.blendMode, sf::Transform::Identity, states.texture, states.shader);
+		frame.commands.push_back({ Command::Type::Vertices, frame.vertices.size(), 0, primitiveType, worldStates });
+	}
+
+	/**
+	 * @fn	void RenderList::appendVertex(const sf::Vertex& vertex, const sf::Transform& transform)
+	 *
+	 * @brief	Appends a vertex, transformed into world space, to the current Vertices command
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	vertex   	The vertex.
+	 * @param	transform	The transform of the vertex.
+	 */
+
+	void appendVertex(const sf::Vertex& vertex, const sf::Transform& transform) {
+		frame.vertices.push_back(sf::Vertex(transform.transformPoint(vertex.position), vertex.color, vertex.texCoords));
+		frame.commands.back().count++;
+	}
+
+	/**
+	 * @fn	static sf::Vector2f RenderList::computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2)
+	 *
+	 * @brief	Computes the unit normal of the edge from p1 to p2
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	p1	The first point.
+	 * @param	p2	The second point.
+	 *
+	 * @return	The normal.
+	 */
+
+	static sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2) {
+		sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+		const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+
+		if (length != 0.0f) {
+			normal /= length;
+		}
+
+		return normal;
+	}
+
+	/**
+	 * @fn	void RenderList::drawShape(const sf::Shape& shape, sf::RenderStates states)
+	 *
+	 * @brief	Records the fill and outline of a convex shape as triangles, matching the geometry sf::Shape generates
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	shape 	The shape.
+	 * @param	states	The render states.
+	 */
+
+	void drawShape(const sf::Shape& shape, sf::RenderStates states) {
+		const std::size_t count = shape.getPointCount();
+
+		if (count < 3) {
+			return;
+		}
+
+		states.transform *= shape.getTransform();
+
+		std::vector<sf::Vector2f> points(count);
+		sf::Vector2f min = shape.getPoint(0);
+		sf::Vector2f max = min;
+
+		for (std::size_t i = 0; i < count; i++) {
+			points[i] = shape.getPoint(i);
+			min.x = std::min(min.x, points[i].x);
+			min.y = std::min(min.y, points[i].y);
+			max.x = std::max(max.x, points[i].x);
+			max.y = std::max(max.y, points[i].y);
+		}
+
+		const sf::Vector2f center = (min + max) / 2.0f;
+
+		if (shape.getFillColor().a > 0) {
+			const sf::IntRect textureRect = shape.getTextureRect();
+			const sf::Vector2f extent = max - min;
+			const sf::Color color = shape.getFillColor();
+
+			auto texCoords = [&](const sf::Vector2f& point) {
+				const float x = extent.x > 0 ? (point.x - min.x) / extent.x : 0;
+				const float y = extent.y > 0 ? (point.y - min.y) / extent.y : 0;
+
+				return sf::Vector2f(textureRect.left + textureRect.width * x, textureRect.top + textureRect.height * y);
+			};
+
+			sf::RenderStates fillStates = states;
+			fillStates.texture = shape.getTexture();
+
+			beginVertices(sf::Triangles, fillStates);
+
+			for (std::size_t i = 1; i + 1 < count; i++) {
+				appendVertex(sf::Vertex(points[0], color, texCoords(points[0])), states.transform);
+				appendVertex(sf::Vertex(points[i], color, texCoords(points[i])), states.transform);
+				appendVertex(sf::Vertex(points[i + 1], color, texCoords(points[i + 1])), states.transform);
+			}
+		}
+
+		const float thickness = shape.getOutlineThickness();
+
+		if (thickness != 0.0f && shape.getOutlineColor().a > 0) {
+			const sf::Color color = shape.getOutlineColor();
+			std::vector<sf::Vector2f> outer(count);
+
+			for (std::size_t i = 0; i < count; i++) {
+				const sf::Vector2f& p0 = points[(i + count - 1) % count];
+				const sf::Vector2f& p1 = points[i];
+				const sf::Vector2f& p2 = points[(i + 1) % count];
+
+				sf::Vector2f n1 = computeNormal(p0, p1);
+				sf::Vector2f n2 = computeNormal(p1, p2);
+
+				// Make sure the normals point away from the center of the shape.
+				if (n1.x * (center.x - p1.x) + n1.y * (center.y - p1.y) > 0) {
+					n1 = -n1;
+				}
+
+				if (n2.x * (center.x - p1.x) + n2.y * (center.y - p1.y) > 0) {
+					n2 = -n2;
+				}
+
+				const float factor = 1.0f + (n1.x * n2.x + n1.y * n2.y);
+				outer[i] = p1 + (n1 + n2) / factor * thickness;
+			}
+
+			sf::RenderStates outlineStates = states;
+			outlineStates.texture = nullptr;
+
+			beginVertices(sf::Triangles, outlineStates);
+
+			for (std::size_t i = 0; i < count; i++) {
+				const std::size_t next = (i + 1) % count;
+
+				appendVertex(sf::Vertex(points[i], color), states.transform);
+				appendVertex(sf::Vertex(outer[i], color), states.transform);
+				appendVertex(sf::Vertex(points[next], color), states.transform);
+
+				appendVertex(sf::Vertex(outer[i], color), states.transform);
+				appendVertex(sf::Vertex(outer[next], color), states.transform);
+				appendVertex(sf::Vertex(points[next], color), states.transform);
+			}
+		}
+	}
+
+	/**
+	 * @fn	void RenderList::drawSprite(const sf::Sprite& sprite, sf::RenderStates states)
+	 *
+	 * @brief	Records a sprite as two triangles
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	sprite	The sprite.
+	 * @param	states	The render states.
+	 */
+
+	void drawSprite(const sf::Sprite& sprite, sf::RenderStates states) {
+		if (sprite.getTexture() == nullptr) {
+			return;
+		}
+
+		states.transform *= sprite.getTransform();
+		states.texture = sprite.getTexture();
+
+		const sf::IntRect rect = sprite.getTextureRect();
+		const sf::FloatRect bounds = sprite.getLocalBounds();
+		const sf::Color color = sprite.getColor();
+
+		const float left = static_cast<float>(rect.left);
+		const float right = left + rect.width;
+		const float top = static_cast<float>(rect.top);
+		const float bottom = top + rect.height;
+
+		const sf::Vertex topLeft({ 0, 0 }, color, { left, top });
+		const sf::Vertex topRight({ bounds.width, 0 }, color, { right, top });
+		const sf::Vertex bottomLeft({ 0, bounds.height }, color, { left, bottom });
+		const sf::Vertex bottomRight({ bounds.width, bounds.height }, color, { right, bottom });
+
+		beginVertices(sf::Triangles, states);
+
+		appendVertex(topLeft, states.transform);
+		appendVertex(bottomLeft, states.transform);
+		appendVertex(topRight, states.transform);
+
+		appendVertex(topRight, states.transform);
+		appendVertex(bottomLeft, states.transform);
+		appendVertex(bottomRight, states.transform);
+	}
+
+	/**
+	 * @fn	void RenderList::drawText(const sf::Text& text, const sf::RenderStates& states)
+	 *
+	 * @brief	Records a copy of text
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	text  	The text.
+	 * @param	states	The render states.
+	 */
+
+	void drawText(const sf::Text& text, const sf::RenderStates& states) {
+		if (text.getFont() == nullptr || text.getString().isEmpty()) {
+			return;
+		}
+
+		recordView();
+
+		// Querying the bounds builds the glyph geometry now, so the copy does not have to look glyphs up when it is rendered.
+		{
+			std::lock_guard<std::mutex> lock(getGlyphMutex());
+			text.getLocalBounds();
+		}
+
+		frame.texts.push_back(text);
+		frame.commands.push_back({ Command::Type::Text, frame.texts.size() - 1, 0, sf::Points, states });
+	}
+
+public:
+
+	/**
+	 * @fn	RenderList::RenderList(sf::Vector2u size)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	size	Size of the target the frames will be rendered to.
+	 */
+
+	RenderList(sf::Vector2u size) :
+		size(size),
+		defaultView(sf::FloatRect(0, 0, static_cast<float>(size.x), static_cast<float>(size.y))),
+		view(defaultView)
+	{ }
+
+	/**
+	 * @fn	static std::mutex& RenderList::getGlyphMutex()
+	 *
+	 * @brief	Gets the mutex guarding glyph loading. sf::Font loads missing glyphs into its page textures, which may grow,
+	 * 			while a RenderThread draws texts with those textures. Lock it around anything that draws a text
+	 * 			or queries its bounds.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The mutex.
+	 */
+
+	static std::mutex& getGlyphMutex() {
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	/**
+	 * @fn	static void RenderList::drawTo(sf::RenderTarget& target, const Renderable& renderable, const sf::RenderStates& states)
+	 *
+	 * @brief	Draws a renderable directly to a render target by recording and rendering it right away.
+	 * 			Used by renderables that are also drawn as sf::Drawable.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	  	The render target.
+	 * @param 		  	renderable	The renderable.
+	 * @param 		  	states	  	The render states.
+	 */
+
+	static void drawTo(sf::RenderTarget& target, const Renderable& renderable, const sf::RenderStates& states) {
+		const sf::View previous = target.getView();
+
+		RenderList renderList(target.getSize());
+		renderList.setView(previous);
+		renderable.draw(renderList, states);
+		renderList.render(target);
+
+		target.setView(previous);
+	}
+
+	/**
+	 * @fn	void RenderList::clear()
+	 *
+	 * @brief	Starts recording a new frame. The current view carries over to the new frame.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		frame.clear();
+		viewRecorded = false;
+	}
+
+	/**
+	 * @fn	void RenderList::swapFrame(Frame& other)
+	 *
+	 * @brief	Exchanges the recorded frame with other and starts recording a new frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	other	Receives the recorded frame, its previous contents are discarded.
+	 */
+
+	void swapFrame(Frame& other) {
+		std::swap(frame, other);
+		clear();
+	}
+
+	/**
+	 * @fn	void RenderList::render(sf::RenderTarget& target, DynamicResolution* resolution = nullptr) const
+	 *
+	 * @brief	Issues the recorded frame on target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	  	The render target.
+	 * @param [in,out]	resolution	(Optional) Renders the dynamic resolution passes, nullptr to render them at native resolution.
+	 */
+
+	void render(sf::RenderTarget& target, DynamicResolution* resolution = nullptr) const {
+		frame.render(target, resolution);
+	}
+
+	/**
+	 * @fn	void RenderList::beginDynamicResolution()
+	 *
+	 * @brief	Renders the following draws at a resolution that adapts to the GPU load, until RenderList::endDynamicResolution()
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void beginDynamicResolution() {
+		frame.commands.push_back({ Command::Type::BeginDynamicResolution, 0, 0, sf::Points, sf::RenderStates::Default });
+		viewRecorded = false;
+	}
+
+	/**
+	 * @fn	void RenderList::endDynamicResolution()
+	 *
+	 * @brief	Stretches the draws since RenderList::beginDynamicResolution() over the target, following draws are at native resolution
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void endDynamicResolution() {
+		frame.commands.push_back({ Command::Type::EndDynamicResolution, 0, 0, sf::Points, sf::RenderStates::Default });
+		viewRecorded = false;
+	}
+
+	/**
+	 * @fn	void RenderList::draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default)
+	 *
+	 * @brief	Records a drawable
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	UnsupportedDrawableException	Thrown when the drawable is neither a Renderable nor a shape, sprite, text or vertex array.
+	 *
+	 * @param	drawable	The drawable.
+	 * @param	states  	(Optional) The render states.
+	 */
+
+	void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default) {
+		if (const Renderable* renderable = dynamic_cast<const Renderable*>(&drawable)) {
+			renderable->draw(*this, states);
+		}
+		else if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+			drawShape(*shape, states);
+		}
+		else if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+			drawSprite(*sprite, states);
+		}
+		else if (const sf::Text* text = dynamic_cast<const sf::Text*>(&drawable)) {
+			drawText(*text, states);
+		}
+		else if (const sf::VertexArray* vertexArray = dynamic_cast<const sf::VertexArray*>(&drawable)) {
+			if (vertexArray->getVertexCount() > 0) {
+				draw(&(*vertexArray)[0], vertexArray->getVertexCount(), vertexArray->getPrimitiveType(), states);
+			}
+		}
+		else {
+			throw UnsupportedDrawableException();
+		}
+	}
+
+	/**
+	 * @fn	void RenderList::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default)
+	 *
+	 * @brief	Records primitives
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	vertices   	The vertices.
+	 * @param	vertexCount	Amount of vertices.
+	 * @param	type	   	The primitive type.
+	 * @param	states	   	(Optional) The render states.
+	 */
+
+	void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) {
+		if (vertexCount == 0) {
+			return;
+		}
+
+		beginVertices(type, states);
+
+		for (std::size_t i = 0; i < vertexCount; i++) {
+			appendVertex(vertices[i], states.transform);
+		}
+	}
+
+	/**
+	 * @fn	void RenderList::setSize(sf::Vector2u size)
+	 *
+	 * @brief	Sets the size of the target the frames will be rendered to
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	size	The size in pixels.
+	 */
+
+	void setSize(sf::Vector2u size) {
+		this->size = size;
+	}
+
+	/**
+	 * @fn	sf::Vector2u RenderList::getSize() const
+	 *
+	 * @brief	Gets the size of the target the frames will be rendered to
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The size in pixels.
+	 */
+
+	sf::Vector2u getSize() const {
+		return size;
+	}
+
+	/**
+	 * @fn	void RenderList::setView(const sf::View& view)
+	 *
+	 * @brief	Sets the view used by the following draws
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	view	The view.
+	 */
+
+	void setView(const sf::View& view) {
+		this->view = view;
+		viewRecorded = false;
+	}
+
+	/**
+	 * @fn	const sf::View& RenderList::getView() const
+	 *
+	 * @brief	Gets the current view
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The view.
+	 */
+
+	const sf::View& getView() const {
+		return view;
+	}
+
+	/**
+	 * @fn	const sf::View& RenderList::getDefaultView() const
+	 *
+	 * @brief	Gets the default view, which covers the target as it was when the RenderList was constructed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The default view.
+	 */
+
+	const sf::View& getDefaultView() const {
+		return defaultView;
+	}
+
+	/**
+	 * @fn	sf::IntRect RenderList::getViewport(const sf::View& view) const
+	 *
+	 * @brief	Gets the viewport of a view in pixels
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	view	The view.
+	 *
+	 * @return	The viewport.
+	 */
+
+	sf::IntRect getViewport(const sf::View& view) const {
+		const float width = static_cast<float>(size.x);
+		const float height = static_cast<float>(size.y);
+		const sf::FloatRect& viewport = view.getViewport();
+
+		return sf::IntRect(
+			static_cast<int>(0.5f + width * viewport.left),
+			static_cast<int>(0.5f + height * viewport.top),
+			static_cast<int>(0.5f + width * viewport.width),
+			static_cast<int>(0.5f + height * viewport.height)
+		);
+	}
+
+	/**
+	 * @fn	sf::Vector2f RenderList::mapPixelToCoords(const sf::Vector2i& point, const sf::View& view) const
+	 *
+	 * @brief	Converts a point from pixel coordinates to world coordinates using view
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	point	The pixel to convert.
+	 * @param	view 	The view.
+	 *
+	 * @return	The world coordinates.
+	 */
+
+	sf::Vector2f mapPixelToCoords(const sf::Vector2i& point, const sf::View& view) const {
+		const sf::IntRect viewport = getViewport(view);
+		const sf::Vector2f normalized(
+			-1.0f + 2.0f * (point.x - viewport.left) / viewport.width,
+			1.0f - 2.0f * (point.y - viewport.top) / viewport.height
+		);
+
+		return view.getInverseTransform().transformPoint(normalized);
+	}
+
+	/**
+	 * @fn	sf::Vector2f RenderList::mapPixelToCoords(const sf::Vector2i& point) const
+	 *
+	 * @brief	Converts a point from pixel coordinates to world coordinates using the current view
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	point	The pixel to convert.
+	 *
+	 * @return	The world coordinates.
+	 */
+
+	sf::Vector2f mapPixelToCoords(const sf::Vector2i& point) const {
+		return mapPixelToCoords(point, view);
+	}
+
+	/**
+	 * @fn	sf::Vector2i RenderList::mapCoordsToPixel(const sf::Vector2f& point, const sf::View& view) const
+	 *
+	 * @brief	Converts a point from world coordinates to pixel coordinates using view
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	point	The point to convert.
+	 * @param	view 	The view.
+	 *
+	 * @return	The pixel coordinates.
+	 */
+
+	sf::Vector2i mapCoordsToPixel(const sf::Vector2f& point, const sf::View& view) const {
+		const sf::Vector2f normalized = view.getTransform().transformPoint(point);
+		const sf::IntRect viewport = getViewport(view);
+
+		return sf::Vector2i(
+			static_cast<int>((normalized.x + 1.0f) / 2.0f * viewport.width + viewport.left),
+			static_cast<int>((-normalized.y + 1.0f) / 2.0f * viewport.height + viewport.top)
+		);
+	}
+
+	/**
+	 * @fn	sf::Vector2i RenderList::mapCoordsToPixel(const sf::Vector2f& point) const
+	 *
+	 * @brief	Converts a point from world coordinates to pixel coordinates using the current view
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	point	The point to convert.
+	 *
+	 * @return	The pixel coordinates.
+	 */
+
+	sf::Vector2i mapCoordsToPixel(const sf::Vector2f& point) const {
+		return mapCoordsToPixel(point, view);
+	}
+};
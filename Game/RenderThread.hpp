@@ -0,0 +1,195 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "RenderList.hpp"
+
+/**
+ * @class	RenderThread
+ *
+ * @brief	Renders recorded frames to a window on a separate thread.
+ *
+ * @detailed Frames pass through three buffers: the RenderList the simulation records into, a pending frame
+ * 			 and the frame that is being rendered. RenderThread::submit() only swaps the recorded frame with the pending one,
+ * 			 so the simulation can record the next frame while the previous one is rendered and presented.
+ * 			 If the simulation submits faster than the window presents, the unrendered pending frame is replaced by the newer one.
+ * 			 While the thread runs it owns the OpenGL context of the window, the simulation may only use the window for events.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class RenderThread {
+	/** @brief	The window to render to */
+	sf::RenderWindow& window;
+
+	/** @brief	Renders the dynamic resolution passes, may be nullptr */
+	DynamicResolution* resolution;
+
+	/** @brief	Guards the fields below */
+	std::mutex mutex;
+
+	/** @brief	Signalled when a frame is submitted, rendered or the thread has to stop */
+	std::condition_variable changed;
+
+	/** @brief	The most recently submitted frame */
+	RenderList::Frame pending;
+
+	/** @brief	The frame being rendered */
+	RenderList::Frame front;
+
+	/** @brief	True if pending holds a frame that has not been rendered */
+	bool hasPending = false;
+
+	/** @brief	True while front is being rendered */
+	bool rendering = false;
+
+	/** @brief	False once the thread has to stop */
+	bool running = true;
+
+	/** @brief	The thread */
+	std::thread thread;
+
+	/**
+	 * @fn	void RenderThread::run()
+	 *
+	 * @brief	Renders and presents submitted frames until the thread is stopped
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void run() {
+		window.setActive(true);
+
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (true) {
+			changed.wait(lock, [this]() {
+				return hasPending || !running;
+			});
+
+			if (!running) {
+				break;
+			}
+
+			std::swap(pending, front);
+			hasPending = false;
+			rendering = true;
+
+			lock.unlock();
+
+			window.clear();
+			front.render(window, resolution);
+			window.display();
+
+			lock.lock();
+
+			rendering = false;
+			changed.notify_all();
+		}
+
+		window.setActive(false);
+	}
+
+public:
+
+	/**
+	 * @fn	RenderThread::RenderThread(sf::RenderWindow& window, DynamicResolution* resolution = nullptr)
+	 *
+	 * @brief	Moves the OpenGL context of window to a new render thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	window	  	The window, must outlive the RenderThread.
+	 * @param [in,out]	resolution	(Optional) Renders the dynamic resolution passes, must outlive the RenderThread and is only used by it.
+	 */
+
+	RenderThread(sf::RenderWindow& window, DynamicResolution* resolution = nullptr) : window(window), resolution(resolution) {
+		window.setActive(false);
+		thread = std::thread(&RenderThread::run, this);
+	}
+
+	RenderThread(const RenderThread&) = delete;
+	RenderThread& operator=(const RenderThread&) = delete;
+
+	/**
+	 * @fn	RenderThread::~RenderThread()
+	 *
+	 * @brief	Stops the thread, dropping a frame that has not been rendered, and gives the OpenGL context back to the calling thread
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~RenderThread() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+
+		changed.notify_all();
+		thread.join();
+
+		window.setActive(true);
+	}
+
+	/**
+	 * @fn	void RenderThread::submit(RenderList& renderList)
+	 *
+	 * @brief	Hands the frame recorded in renderList to the render thread, renderList starts recording a new frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	renderList	The render list.
+	 */
+
+	void submit(RenderList& renderList) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			renderList.swapFrame(pending);
+			hasPending = true;
+		}
+
+		changed.notify_all();
+	}
+
+	/**
+	 * @fn	void RenderThread::finish()
+	 *
+	 * @brief	Blocks until every submitted frame has been rendered.
+	 * 			Call this before destroying textures or fonts that submitted frames may still use.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void finish() {
+		std::unique_lock<std::mutex> lock(mutex);
+
+		changed.wait(lock, [this]() {
+			return !hasPending && !rendering;
+		});
+	}
+
+	/**
+	 * @fn	const RenderList::Frame& RenderThread::getLastFrame()
+	 *
+	 * @brief	Blocks until every submitted frame has been rendered and returns the one that was rendered last
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The frame, valid and left untouched by the render thread until the next RenderThread::submit().
+	 */
+
+	const RenderList::Frame& getLastFrame() {
+		finish();
+		return front;
+	}
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+class RenderList;
+
+/**
+ * @class	Renderable
+ *
+ * @brief	Interface for drawables that can record themselves into a RenderList.
+ *
+ * @detailed A RenderList only knows how to record the SFML primitives. Drawables built out of other drawables
+ * 			 implement this interface, so RenderList::draw() can record the primitives they consist of.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class Renderable {
+public:
+
+	/**
+	 * @fn	virtual void Renderable::draw(RenderList& renderList, sf::RenderStates states) const = 0;
+	 *
+	 * @brief	Records this object into renderList
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	renderList	The render list.
+	 * @param 		  	states	  	The render states.
+	 */
+
+	virtual void draw(RenderList& renderList, sf::RenderStates states) const = 0;
+
+	/**
+	 * @fn	virtual const sf::Texture* Renderable::getBatchTexture() const
+	 *
+	 * @brief	Gets the texture all primitives of this object are drawn with, so it can be grouped with drawables that share it
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The texture, nullptr if the primitives use no or several textures.
+	 */
+
+	virtual const sf::Texture* getBatchTexture() const {
+		return nullptr;
+	}
+
+	/**
+	 * @fn	virtual Renderable::~Renderable()
+	 *
+	 * @brief	Destructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	virtual ~Renderable() { }
+};
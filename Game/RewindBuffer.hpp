@@ -0,0 +1,462 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+
+/**
+ * @class	StateWriter
+ *
+ * @brief	Appends trivially copyable values to a word buffer, producing the state recorded by a RewindBuffer.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class StateWriter {
+	/** @brief	The buffer written to */
+	std::vector<uint32_t>& words;
+
+public:
+
+	/**
+	 * @fn	StateWriter::StateWriter(std::vector<uint32_t>& words)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	words	The buffer to append to.
+	 */
+
+	StateWriter(std::vector<uint32_t>& words) : words(words) { }
+
+	/**
+	 * @fn	template<class T> void StateWriter::write(const T& value)
+	 *
+	 * @brief	Appends value, padded to whole words
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	A trivially copyable type without padding bytes. Padding bytes hold indeterminate values
+	 * 				that RewindBuffer would record as changes.
+	 * @param	value	The value.
+	 */
+
+	template<class T>
+	void write(const T& value) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable state can be recorded");
+
+		const std::size_t offset = words.size();
+		words.resize(offset + (sizeof(T) + 3) / 4, 0);
+		std::memcpy(static_cast<void*>(&words[offset]), static_cast<const void*>(&value), sizeof(T));
+	}
+};
+
+/**
+ * @class	StateReader
+ *
+ * @brief	Reads values back from a word buffer in the order a StateWriter appended them.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class StateReader {
+	/** @brief	The buffer read from */
+	const std::vector<uint32_t>& words;
+
+	/** @brief	Index of the next word */
+	std::size_t position = 0;
+
+public:
+
+	/**
+	 * @fn	StateReader::StateReader(const std::vector<uint32_t>& words)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	words	The buffer to read from.
+	 */
+
+	StateReader(const std::vector<uint32_t>& words) : words(words) { }
+
+	/**
+	 * @fn	template<class T> bool StateReader::read(T& value)
+	 *
+	 * @brief	Reads the next value
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	T	The trivially copyable type that was written.
+	 * @param [out]	value	The value.
+	 *
+	 * @return	False if the buffer holds no further value, value is then left untouched.
+	 */
+
+	template<class T>
+	bool read(T& value) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable state can be recorded");
+
+		const std::size_t size = (sizeof(T) + 3) / 4;
+
+		if (position + size > words.size()) {
+			return false;
+		}
+
+		std::memcpy(static_cast<void*>(&value), static_cast<const void*>(&words[position]), sizeof(T));
+		position += size;
+		return true;
+	}
+};
+
+/**
+ * @class	RewindBuffer
+ *
+ * @brief	Ring buffer of the simulation state of the most recent ticks.
+ *
+ * @detailed Every tick the state is recorded as a buffer of words, see StateWriter.
+ * 			 Ticks are stored in groups that start with a keyframe holding the whole state, the following ticks of a group
+ * 			 only store the words that changed since the previous tick as (index, value) pairs.
+ * 			 Once all groups are in use the oldest group is dropped and its storage reused, so the memory footprint
+ * 			 is bounded by the amount of groups. Restoring a tick applies at most a group worth of deltas to a keyframe.
+ * 			 @code{.cpp}
+ * 			   // every simulation tick
+ * 			   state.clear();
+ * 			   StateWriter(state).write(player.getSnapshot());
+ * 			   rewindBuffer.record(state);
+ * 			   // rewinding
+ * 			   if (rewindBuffer.restore(tick, state)) {
+ * 			       rewindBuffer.truncate(tick);
+ * 			   }
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class RewindBuffer {
+	/**
+	 * @struct	Group
+	 *
+	 * @brief	A keyframe and the deltas of the ticks following it.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Group {
+		/** @brief	Tick of the keyframe */
+		uint32_t firstTick = 0;
+
+		/** @brief	The whole state at firstTick */
+		std::vector<uint32_t> keyframe;
+
+		/** @brief	Per following tick the amount of changed words, followed by an index and value per changed word */
+		std::vector<uint32_t> deltas;
+
+		/** @brief	Offset in deltas where every following tick starts */
+		std::vector<std::size_t> tickOffsets;
+
+		/**
+		 * @fn	uint32_t Group::getTickCount() const
+		 *
+		 * @brief	Gets the amount of ticks in the group
+		 *
+		 * @author	Julian
+		 * @date	2026-10-19
+		 *
+		 * @return	The amount of ticks, including the keyframe.
+		 */
+
+		uint32_t getTickCount() const {
+			return static_cast<uint32_t>(tickOffsets.size()) + 1;
+		}
+	};
+
+	/** @brief	Amount of ticks per group */
+	uint32_t keyframeInterval;
+
+	/** @brief	Maximum amount of groups */
+	std::size_t groupCount;
+
+	/** @brief	The groups, oldest first */
+	std::deque<Group> groups;
+
+	/** @brief	State of the newest tick, deltas are computed against it */
+	std::vector<uint32_t> previous;
+
+	/** @brief	Tick the next recorded state gets */
+	uint32_t nextTick = 0;
+
+	/**
+	 * @fn	Group& RewindBuffer::startGroup()
+	 *
+	 * @brief	Starts a new group, reusing the storage of the oldest one when all groups are in use
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The new group.
+	 */
+
+	Group& startGroup() {
+		if (groups.size() >= groupCount) {
+			Group reused = std::move(groups.front());
+			groups.pop_front();
+			groups.push_back(std::move(reused));
+		}
+		else {
+			groups.emplace_back();
+		}
+
+		Group& group = groups.back();
+		group.keyframe.clear();
+		group.deltas.clear();
+		group.tickOffsets.clear();
+
+		return group;
+	}
+
+	/**
+	 * @fn	const Group* RewindBuffer::findGroup(uint32_t tick) const
+	 *
+	 * @brief	Finds the group holding tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	tick	The tick.
+	 *
+	 * @return	The group, nullptr if tick is outside of the window.
+	 */
+
+	const Group* findGroup(uint32_t tick) const {
+		for (auto it = groups.rbegin(); it != groups.rend(); ++it) {
+			if (tick >= it->firstTick) {
+				return tick - it->firstTick < it->getTickCount() ? &*it : nullptr;
+			}
+		}
+
+		return nullptr;
+	}
+
+public:
+
+	/**
+	 * @fn	RewindBuffer::RewindBuffer(uint32_t keyframeInterval = 30, std::size_t groupCount = 10)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	keyframeInterval	(Optional) Amount of ticks between keyframes, bounds the cost of restoring a tick.
+	 * @param	groupCount			(Optional) Amount of keyframes kept, the window is keyframeInterval * groupCount ticks.
+	 */
+
+	RewindBuffer(uint32_t keyframeInterval = 30, std::size_t groupCount = 10) :
+		keyframeInterval(std::max<uint32_t>(1, keyframeInterval)),
+		groupCount(std::max<std::size_t>(1, groupCount))
+	{ }
+
+	/**
+	 * @fn	uint32_t RewindBuffer::record(const std::vector<uint32_t>& state)
+	 *
+	 * @brief	Records the state of the next tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	state	The state, written by a StateWriter.
+	 *
+	 * @return	The tick the state was recorded as.
+	 */
+
+	uint32_t record(const std::vector<uint32_t>& state) {
+		const uint32_t tick = nextTick++;
+
+		if (groups.empty() || groups.back().getTickCount() >= keyframeInterval || state.size() != previous.size()) {
+			Group& group = startGroup();
+			group.firstTick = tick;
+			group.keyframe = state;
+		}
+		else {
+			Group& group = groups.back();
+			const std::size_t countOffset = group.deltas.size();
+
+			group.tickOffsets.push_back(countOffset);
+			group.deltas.push_back(0);
+
+			for (std::size_t i = 0; i < state.size(); i++) {
+				if (state[i] != previous[i]) {
+					group.deltas.push_back(static_cast<uint32_t>(i));
+					group.deltas.push_back(state[i]);
+				}
+			}
+
+			group.deltas[countOffset] = static_cast<uint32_t>((group.deltas.size() - countOffset - 1) / 2);
+		}
+
+		previous = state;
+		return tick;
+	}
+
+	/**
+	 * @fn	bool RewindBuffer::restore(uint32_t tick, std::vector<uint32_t>& state) const
+	 *
+	 * @brief	Reconstructs the state of a tick in the window
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param 		  	tick 	The tick, between RewindBuffer::getOldestTick() and RewindBuffer::getNewestTick().
+	 * @param [out]		state	The state, to be read with a StateReader.
+	 *
+	 * @return	False if tick is outside of the window.
+	 */
+
+	bool restore(uint32_t tick, std::vector<uint32_t>& state) const {
+		const Group* group = findGroup(tick);
+
+		if (group == nullptr) {
+			return false;
+		}
+
+		state = group->keyframe;
+
+		for (uint32_t i = 0; i < tick - group->firstTick; i++) {
+			std::size_t offset = group->tickOffsets[i];
+			const uint32_t count = group->deltas[offset++];
+
+			for (uint32_t j = 0; j < count; j++, offset += 2) {
+				state[group->deltas[offset]] = group->deltas[offset + 1];
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @fn	void RewindBuffer::truncate(uint32_t tick)
+	 *
+	 * @brief	Drops the ticks after tick, so recording continues from a restored tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	tick	The last tick to keep.
+	 */
+
+	void truncate(uint32_t tick) {
+		while (!groups.empty() && groups.back().firstTick > tick) {
+			groups.pop_back();
+		}
+
+		if (groups.empty()) {
+			clear();
+			return;
+		}
+
+		Group& group = groups.back();
+		const uint32_t kept = std::min(tick - group.firstTick, group.getTickCount() - 1);
+
+		if (kept < group.tickOffsets.size()) {
+			group.deltas.resize(group.tickOffsets[kept]);
+			group.tickOffsets.resize(kept);
+		}
+
+		nextTick = group.firstTick + group.getTickCount();
+		restore(nextTick - 1, previous);
+	}
+
+	/**
+	 * @fn	void RewindBuffer::clear()
+	 *
+	 * @brief	Drops every recorded tick, the next recorded tick is 0 again
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		groups.clear();
+		previous.clear();
+		nextTick = 0;
+	}
+
+	/**
+	 * @fn	bool RewindBuffer::empty() const
+	 *
+	 * @brief	Query if no tick has been recorded
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if empty.
+	 */
+
+	bool empty() const {
+		return groups.empty();
+	}
+
+	/**
+	 * @fn	uint32_t RewindBuffer::getOldestTick() const
+	 *
+	 * @brief	Gets the oldest tick that can be restored
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The oldest tick, only valid if the buffer is not empty.
+	 */
+
+	uint32_t getOldestTick() const {
+		return groups.empty() ? 0 : groups.front().firstTick;
+	}
+
+	/**
+	 * @fn	uint32_t RewindBuffer::getNewestTick() const
+	 *
+	 * @brief	Gets the most recently recorded tick
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The newest tick, only valid if the buffer is not empty.
+	 */
+
+	uint32_t getNewestTick() const {
+		return nextTick == 0 ? 0 : nextTick - 1;
+	}
+
+	/**
+	 * @fn	std::size_t RewindBuffer::getByteSize() const
+	 *
+	 * @brief	Gets the memory used by the recorded ticks
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The size in bytes.
+	 */
+
+	std::size_t getByteSize() const {
+		std::size_t bytes = previous.size() * sizeof(uint32_t);
+
+		for (const Group& group : groups) {
+			bytes += (group.keyframe.size() + group.deltas.size()) * sizeof(uint32_t) + group.tickOffsets.size() * sizeof(std::size_t);
+		}
+
+		return bytes;
+	}
+};
@@ -11,6 +11,11 @@
 #include "MapLoader.hpp"
 #include "PowerUps.hpp"
 #include "IntersectionGroup.hpp"
+#include "AnimationLibrary.hpp"
+#include "AnimationSystem.hpp"
+#include "ParticleSystem.hpp"
+#include "EventConnectionVector.hpp"
+#include "RewindBuffer.hpp"
 
 /**
  * @class	Running
@@ -26,14 +31,22 @@ class Running : public State {
 	/** @brief	The statemachine */
 	Statemachine& statemachine;
 
+	/** @brief	References to the assets the state keeps pointers to, so AssetManager::collect() does not evict them while the state is paused */
+	std::vector<AssetReference> assets;
+
 	/** @brief	The dynamic focus */
 	ViewFocus focus;
 	/** @brief	The map */
 	Map map;
+	/** @brief	The level blocks, which do not move and are drawn through the static geometry of map */
+	EntityWorld blocks;
 
 	/** @brief	The background music */
 	sf::Music backgroundMusic;
 
+	/** @brief	The keys of the current tick, collected from the input sampler */
+	KeyboardState keyboardState;
+
 	/** @brief	The key released connection */
 	EventConnection keyReleasedConnection;
 	/** @brief	The died connection */
@@ -41,6 +54,22 @@ class Running : public State {
 	/** @brief	The fell off map connection */
 	EventConnection fellOffMapConnection;
 
+	/** @brief	The animation clips */
+	AnimationLibrary animationLibrary;
+	/** @brief	The animations of all animated sprites */
+	AnimationSystem animations;
+
+	/** @brief	The particle effects */
+	ParticleSystem particles;
+	/** @brief	Effect spawned where the player picks up a heal */
+	ParticleEffect healEffect;
+	/** @brief	Effect spawned where the player dies */
+	ParticleEffect deathEffect;
+	/** @brief	Dust kicked up behind the death */
+	ParticleEffect dustEffect;
+	/** @brief	The power-up applied connections */
+	EventConnectionVector powerUpConnections;
+
 	/** @brief	The player */
     Player player;
 	/** @brief	The death */
@@ -63,12 +92,77 @@ class Running : public State {
 
 	/** @brief	The background */
 	sf::Sprite background;
+
+	/** @brief	State of the map right after loading, restored when restarting */
+	Map::Snapshot mapSnapshot;
+	/** @brief	State of the player right after loading */
+	Player::Snapshot playerSnapshot;
+	/** @brief	State of the death right after loading */
+	Body::Snapshot deathSnapshot;
+	/** @brief	State of the scythe right after loading */
+	Body::Snapshot deathSikkelSnapshot;
+
+	/** @brief	The state of the last ticks, 5 seconds at 60 ticks per second */
+	RewindBuffer rewindBuffer = RewindBuffer(30, 10);
+	/** @brief	Buffer the state of a tick is written to and restored in, reused every tick */
+	std::vector<uint32_t> rewindState;
+
+	/**
+	 * @fn	sf::Texture& Running::holdTexture(const std::string& id)
+	 *
+	 * @brief	Takes a reference to a texture for the lifetime of the state and gets it
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotLoadedException	Thrown when the texture was never loaded.
+	 *
+	 * @param	id	The texture identifier.
+	 *
+	 * @return	The texture.
+	 */
+
+	sf::Texture& holdTexture(const std::string& id) {
+		assets.emplace_back(id);
+		return AssetManager::instance()->getTexture(id);
+	}
+
+	/**
+	 * @fn	void Running::recordTick()
+	 *
+	 * @brief	Records the state of the characters and the map objects in the rewind buffer
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void recordTick() {
+		rewindState.clear();
+
+		StateWriter writer(rewindState);
+		writer.write(player.getSnapshot());
+		writer.write(death.getSnapshot());
+		writer.write(deathSikkel.getSnapshot());
+		writer.write(bodyRemoveToggleIndex);
+
+		// Objects are recorded with their handle, removed objects shift the ones after them.
+		for (const ObjectArena::Pointer<Body>& object : map) {
+			writer.write(map.getHandle(*object));
+			writer.write(object->getSnapshot());
+		}
+
+		rewindBuffer.record(rewindState);
+	}
 public:
 
 	/**
-	 * @fn	Running::Running(Statemachine& statemachine) : statemachine(statemachine), focus(statemachine.window), score(AssetManager::instance()->getFont("arial"))
+	 * @fn	Running::Running(Statemachine& statemachine) : statemachine(statemachine), focus(statemachine.renderList), score(AssetManager::instance()->getFont("arial"))
 	 *
 	 * @brief	Running constructor, This constructor sets-up all the objects using The map file and adds collision. Creates the player and death with a default position and texture.
+	 * 			Thread safety: the state is constructed on a worker thread while the cutscene plays, see Statemachine::prewarmState().
+	 * 			The render list of statemachine is only stored, never used, and every texture and sound is taken through an AssetReference
+	 * 			before it is gotten, so neither the cutscene loading and unloading its images nor AssetManager::collect() can remove an asset
+	 * 			the state points to. The font of the score is held by main().
 	 *
 	 * @author	Jeffrey de Waal
 	 * @date	1/25/2018
@@ -78,9 +172,9 @@ public:
 
 	Running(Statemachine& statemachine) :
 		statemachine(statemachine),
-		focus(statemachine.window),
+		focus(statemachine.renderList),
 		score(AssetManager::instance()->getFont("arial")),
-        player(statemachine.window)
+        player(statemachine.renderList)
 	{
 		using Type = MapFactory::Type;
 		using Value = MapFactory::Value;
@@ -92,52 +186,189 @@ public:
 		mapFactory.registerCreateMethod("player", [&](Map& map, const MapItemProperties& properties) {
             properties.read({
 				{ "Position", Type::Vector, [&](Value value) { player.setPosition(*value.vectorValue); } },
-				{ "TextureId", Type::String, [&](Value value) { player.setTexture(&AssetManager::instance()->getTexture(*value.stringValue)); } }
+				{ "TextureId", Type::String, [&](Value value) { player.setTexture(&holdTexture(*value.stringValue)); } }
 			});
-			map.addDrawable(player);
+			map.addDrawable(player, CullMode::Dynamic, RenderLayer::Actors);
 			map.setPrimaryCollidable(player);
 		});
 
 		mapFactory.registerCreateMethod("death", [&](Map& map, const MapItemProperties& properties) {
 			properties.read({
 				{ "Position", Type::Vector, [&](Value value) { death.setPosition(*value.vectorValue); } },
-				{ "TextureId", Type::String, [&](Value value) { death.setTexture(&AssetManager::instance()->getTexture(*value.stringValue)); } }
+				{ "TextureId", Type::String, [&](Value value) { death.setTexture(&holdTexture(*value.stringValue)); } }
 			});
-			death.setTexture(&AssetManager::instance()->getTexture("death"));
+			death.setTexture(&holdTexture("death"));
 			deathSikkel.setPosition({ -50, 285});
-			deathSikkel.setTexture(&AssetManager::instance()->getTexture("deathsikkel"));
+			deathSikkel.setTexture(&holdTexture("deathsikkel"));
 			deathSikkel.setSize({ 100,400 });
-			map.addDrawable(death);
-			map.addDrawable(deathSikkel);
+			map.addDrawable(death, CullMode::Dynamic, RenderLayer::Actors);
+			// The scythe is held in front of the blocks and the player.
+			map.addDrawable(deathSikkel, CullMode::Dynamic, RenderLayer::Actors, 1.0f);
 			map.addCollidable(death);
 		});
 
 		mapFactory.registerCreateMethod("heal-power-up", [&](Map& map, const MapItemProperties& properties) {
-			IntersectionGroup* powerUpIntersectionGroup = new IntersectionGroup();
-			Heal* heal = new Heal(powerUpIntersectionGroup);
-
-			map.addDrawable(heal);
-			map.addObject(heal);
+			IntersectionGroup* powerUpIntersectionGroup = &map.createObjectGroup<IntersectionGroup>();
+			Heal* heal = &map.createObject<Heal>(powerUpIntersectionGroup);
 
 			properties.read({
 				{ "Color", Type::Color, [&](Value value) { heal->setFillColor(*value.colorValue); } },
 				{ "Position", Type::Vector, [&](Value value) { heal->setPosition(*value.vectorValue); } },
 				{ "Value", Type::Float, [&](Value value) { heal->setHealValue(value.floatValue); } },
-				{ "TextureId", Type::String, [&](Value value) { heal->setTexture(&AssetManager::instance()->getTexture(*value.stringValue)); } }
+				{ "TextureId", Type::String, [&](Value value) { heal->setTexture(&holdTexture(*value.stringValue)); } }
 			});
 
+			// Power-ups do not move, index them once their position is known.
+			map.addDrawable(heal, CullMode::Static);
+
 			powerUpIntersectionGroup->setPrimary(heal);
 			powerUpIntersectionGroup->add(player);
 
-			map.addObjectGroup(*powerUpIntersectionGroup);
-
 			powerUps.emplace_back(heal);
 		});
 
-		map = mapFactory.buildMap();
+		map = mapFactory.buildMap(blocks);
+		map.addStaticGeometry(blocks);
+
+		// The sounds are played by the characters and the power-ups, the textures of the blocks and the animations are held by the map.
+		assets.emplace_back("laugh");
+		assets.emplace_back("jump");
+		assets.emplace_back("heal");
+		map.setChunkCaching(true);
+
+		std::ifstream animationFile("animations.txt");
+		animationLibrary.load(animationFile);
+		player.setAnimations(animations, animationLibrary);
 		
-		background.setTexture(AssetManager::instance()->getTexture("background"));
+		background.setTexture(holdTexture("background"));
 		background.setTextureRect({ 0, 0, 1280, 720 });
+		map.addDrawable(background, CullMode::Never, RenderLayer::Background);
+		map.addDrawable(particles, CullMode::Never, RenderLayer::Effects);
+
+		healEffect.startColor = sf::Color(120, 255, 120);
+		healEffect.endColor = sf::Color(255, 255, 255, 0);
+		healEffect.direction = -90.0f;
+		healEffect.spread = 120.0f;
+		healEffect.acceleration = { 0, 150 };
+
+		deathEffect.startColor = sf::Color(140, 0, 0);
+		deathEffect.endColor = sf::Color(40, 0, 0, 0);
+		deathEffect.startSize = 8.0f;
+		deathEffect.minSpeed = 100.0f;
+		deathEffect.maxSpeed = 400.0f;
+		deathEffect.minLifetime = 1.0f;
+		deathEffect.maxLifetime = 2.5f;
+		deathEffect.acceleration = { 0, 600 };
+
+		dustEffect.startColor = sf::Color(90, 80, 70, 160);
+		dustEffect.endColor = sf::Color(90, 80, 70, 0);
+		dustEffect.startSize = 4.0f;
+		dustEffect.endSize = 14.0f;
+		dustEffect.minSpeed = 10.0f;
+		dustEffect.maxSpeed = 40.0f;
+		dustEffect.direction = -90.0f;
+		dustEffect.spread = 90.0f;
+		dustEffect.minLifetime = 0.8f;
+		dustEffect.maxLifetime = 1.5f;
+		particles.attach(death, dustEffect, 40.0f, { 0, 190 });
+
+		mapSnapshot = map.getSnapshot();
+		playerSnapshot = player.getSnapshot();
+		deathSnapshot = death.getSnapshot();
+		deathSikkelSnapshot = deathSikkel.getSnapshot();
+	}
+
+	/**
+	 * @fn	bool Running::restart() override
+	 *
+	 * @brief	Restores the map and the characters to the snapshots taken after loading, instead of loading the map again
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True.
+	 */
+
+	bool restart() override {
+		if (gameOver) {
+			// Left connected by exit() when the previous game ended.
+			diedConnection.disconnect();
+			fellOffMapConnection.disconnect();
+		}
+
+		map.restore(mapSnapshot);
+		player.restore(playerSnapshot);
+		death.restore(deathSnapshot);
+		deathSikkel.restore(deathSikkelSnapshot);
+
+		for (PowerUp* powerUp : powerUps) {
+			powerUp->setUsed(false);
+		}
+
+		particles.clearParticles();
+		rewindBuffer.clear();
+
+		gameOver = false;
+		gameOverCounter = 3.0f;
+		bodyRemoveToggleIndex = 0;
+
+		return true;
+	}
+
+	/**
+	 * @fn	bool Running::rewind(uint32_t ticks)
+	 *
+	 * @brief	Restores the characters and the map objects to the state of ticks ago, ticks after it are dropped
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	ticks	The amount of ticks to go back, clamped to the oldest recorded tick.
+	 *
+	 * @return	False if no tick has been recorded.
+	 */
+
+	bool rewind(uint32_t ticks) {
+		if (rewindBuffer.empty()) {
+			return false;
+		}
+
+		const uint32_t newest = rewindBuffer.getNewestTick();
+		const uint32_t tick = newest - std::min(ticks, newest - rewindBuffer.getOldestTick());
+
+		if (!rewindBuffer.restore(tick, rewindState)) {
+			return false;
+		}
+
+		Player::Snapshot playerState;
+		Body::Snapshot bodyState;
+		ObjectHandle handle;
+
+		StateReader reader(rewindState);
+
+		if (reader.read(playerState)) {
+			player.restore(playerState);
+		}
+
+		if (reader.read(bodyState)) {
+			death.restore(bodyState);
+		}
+
+		if (reader.read(bodyState)) {
+			deathSikkel.restore(bodyState);
+		}
+
+		reader.read(bodyRemoveToggleIndex);
+
+		// Objects removed since the tick stay removed.
+		while (reader.read(handle) && reader.read(bodyState)) {
+			if (Body* object = map.getObject(handle)) {
+				object->restore(bodyState);
+			}
+		}
+
+		rewindBuffer.truncate(tick);
+		return true;
 	}
 
 	/**
@@ -150,6 +381,9 @@ public:
 	 */
 
 	void entry() override {
+		requireAsset("background");
+		requireAsset("laugh");
+
 		backgroundMusic.openFromFile("sound.wav");
 		backgroundMusic.setLoop(true);
 		backgroundMusic.setVolume(15);
@@ -171,18 +405,29 @@ public:
 
 		for (PowerUp* powerUp : powerUps) {
 			powerUp->connect(player, map);
+
+			powerUpConnections.connect(powerUp->applied, [this](Player& player) {
+				particles.burst(healEffect, player.getPosition(), 150);
+			});
 		}
 
 		keyReleasedConnection = game.keyboard.keyReleased.connect([this](sf::Keyboard::Key key) {
 			if (key == sf::Keyboard::Key::Escape) {
 				statemachine.doTransition("game-pauze");
 			}
+#ifdef ENABLE_DEBUG_MODE
+			// Rewinding is for testing, the game itself does not let the player undo.
+			else if (key == sf::Keyboard::Key::BackSpace && !gameOver) {
+				rewind(120);
+			}
+#endif // ENABLE_DEBUG_MODE
 		});
 
 		diedConnection = game.died.connect([this]() {
 			if (gameOver == false) {
 				std::cout << "/!\\ death got you /!\\" << std::endl;
 				AssetManager::instance()->getSound("laugh").play();
+				particles.burst(deathEffect, player.getPosition(), 1500);
 				gameOver = true;
 			}
 		});
@@ -190,6 +435,7 @@ public:
 		fellOffMapConnection = game.fellOffMap.connect([this]() {
 			if (gameOver == false) {
 				std::cout << "/!\\ fell out of the world /!\\" << std::endl;
+				particles.burst(deathEffect, player.getPosition(), 1500);
 				gameOver = true;
 			}
 		});
@@ -198,13 +444,16 @@ public:
 	/**
 	 * @fn	void Running::exit() override
 	 *
-	 * @brief	Disconnects all the eventconnections used in this state and sets the focus to the default position
+	 * @brief	Freezes the last frame, disconnects all the eventconnections used in this state and sets the focus to the default position
 	 *
 	 * @author	Jeffrey de Waal
 	 * @date	1/25/2018
 	 */
 
 	void exit() override {
+		// The pause and game over screens are drawn over the last frame of the level.
+		statemachine.freezeFrame();
+
 		focus.unsetFocus();
 		focus.update();
 		backgroundMusic.stop();
@@ -215,6 +464,8 @@ public:
 			powerUp->disconnect();
 		}
 
+		powerUpConnections.disconnect();
+
 		keyReleasedConnection.disconnect();
 
 		if (!gameOver) {
@@ -236,14 +487,25 @@ public:
 	 */
 
 	void update(const float elapsedTime) override {
-		background.setPosition(statemachine.window.mapPixelToCoords({ 0, 0 }));
-		statemachine.window.draw(background);
+		// The background and the map are rendered at a resolution that follows the GPU load, the HUD at native resolution.
+		statemachine.renderList.beginDynamicResolution();
+
+		background.setPosition(statemachine.renderList.mapPixelToCoords({ 0, 0 }));
+
+		if (game.input != nullptr) {
+			game.input->collect(keyboardState);
+		}
+
 		map.resolve();
+		CollisionSystem::resolve(blocks, player);
 
 		if (!gameOver) {
+			player.sample(keyboardState);
 			player.update(elapsedTime);
 			death.update(elapsedTime);
 			deathSikkel.update(elapsedTime);
+
+			animations.update(elapsedTime);
 		}
 		else if (gameOverCounter > 0) {
 			gameOverCounter -= elapsedTime;
@@ -267,11 +529,23 @@ public:
 
 		death.update(elapsedTime);
 		deathSikkel.update(elapsedTime);
+		particles.update(elapsedTime);
 
 		map.resolve();
-		map.draw(statemachine.window);
+		CollisionSystem::resolve(blocks, player);
+
+		// Objects removed during the tick are destroyed before the frame is recorded.
+		map.flushRemovals();
+
+		if (!gameOver) {
+			recordTick();
+		}
+
+		map.draw(statemachine.renderList);
+
+		statemachine.renderList.endDynamicResolution();
 
-		statemachine.window.draw(score);
+		statemachine.renderList.draw(score);
 
 		player.updateKeySchemeDisplay();
 
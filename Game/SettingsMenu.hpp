@@ -4,6 +4,7 @@
 #include "Statemachine.hpp"
 #include "Characters.hpp"
 #include "Button.hpp"
+#include "UiLayer.hpp"
 
 /**
  * @class	SettingsMenu
@@ -46,6 +47,9 @@ class SettingsMenu : public State {
     /** @brief	The mouse leave connection */
     EventConnection mouseLeaveConn;
 
+    /** @brief	Retained composition of the widgets */
+    UiLayer ui;
+
 public:
 
     /**
@@ -84,6 +88,10 @@ public:
         exitButton.setCharSize(32);
         exitButton.setBackgroundColor({0,153,51});
         exitButton.setText("Return to main menu");
+
+        ui.add(menuLabel);
+        ui.add(exitButton);
+        ui.add(volumeLabel);
     }
 
     /**
@@ -160,8 +168,21 @@ public:
      */
 
     void update(const float elapsedTime) override {
-		statemachine.window.draw(menuLabel);
-		statemachine.window.draw(exitButton);
-		statemachine.window.draw(volumeLabel);
+		ui.draw(statemachine.renderList);
+    }
+
+    /**
+     * @fn	bool SettingsMenu::needsRedraw() const override
+     *
+     * @brief	Only redraws when one of the widgets changed.
+     *
+     * @author	Julian
+     * @date	2026-10-19
+     *
+     * @return	True if the widgets have to be recomposed.
+     */
+
+    bool needsRedraw() const override {
+		return ui.isDirty();
     }
 };
\ No newline at end of file
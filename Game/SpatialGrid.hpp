@@ -0,0 +1,175 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class	SpatialGrid
+ *
+ * @brief	Uniform grid spatial index over world space.
+ *
+ * @detailed Every item is stored under an identifier in each cell its bounding box overlaps.
+ * 			 A query visits the cells overlapping the queried area, so its cost depends on the size of the area
+ * 			 instead of the amount of items in the grid. Items spanning several cells are reported once per cell,
+ * 			 callers are responsible for deduplicating.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class SpatialGrid {
+	/** @brief	Width and height of a single cell in world units */
+	float cellSize;
+
+	/** @brief	Item identifiers per cell, keyed by the packed cell coordinate */
+	std::unordered_map<int64_t, std::vector<std::size_t>> cells;
+
+	/**
+	 * @fn	static int64_t SpatialGrid::cellKey(int32_t x, int32_t y)
+	 *
+	 * @brief	Packs a cell coordinate into a single key
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	x	The cell column.
+	 * @param	y	The cell row.
+	 *
+	 * @return	The cell key.
+	 */
+
+	static int64_t cellKey(int32_t x, int32_t y) {
+		return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+	}
+
+	/**
+	 * @fn	template<class F> void SpatialGrid::forEachCell(const sf::FloatRect& area, F func) const
+	 *
+	 * @brief	Invokes func with the coordinate of every cell overlapping area
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	F	Callable taking (int32_t x, int32_t y).
+	 * @param	area	The area in world coordinates.
+	 * @param	func	The function to invoke.
+	 */
+
+	template<class F>
+	void forEachCell(const sf::FloatRect& area, F func) const {
+		const int32_t left = static_cast<int32_t>(std::floor(area.left / cellSize));
+		const int32_t top = static_cast<int32_t>(std::floor(area.top / cellSize));
+		const int32_t right = static_cast<int32_t>(std::floor((area.left + area.width) / cellSize));
+		const int32_t bottom = static_cast<int32_t>(std::floor((area.top + area.height) / cellSize));
+
+		for (int32_t y = top; y <= bottom; y++) {
+			for (int32_t x = left; x <= right; x++) {
+				func(x, y);
+			}
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	SpatialGrid::SpatialGrid(float cellSize = 256.0f)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	cellSize	(Optional) Width and height of a cell in world units.
+	 */
+
+	SpatialGrid(float cellSize = 256.0f) : cellSize(cellSize) { }
+
+	/**
+	 * @fn	void SpatialGrid::insert(std::size_t id, const sf::FloatRect& bounds)
+	 *
+	 * @brief	Inserts an item in every cell overlapping bounds
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	  	The item identifier.
+	 * @param	bounds	The bounds of the item in world coordinates.
+	 */
+
+	void insert(std::size_t id, const sf::FloatRect& bounds) {
+		forEachCell(bounds, [&](int32_t x, int32_t y) {
+			cells[cellKey(x, y)].push_back(id);
+		});
+	}
+
+	/**
+	 * @fn	void SpatialGrid::remove(std::size_t id, const sf::FloatRect& bounds)
+	 *
+	 * @brief	Removes an item, bounds must be the bounds it was inserted with
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id	  	The item identifier.
+	 * @param	bounds	The bounds the item was inserted with.
+	 */
+
+	void remove(std::size_t id, const sf::FloatRect& bounds) {
+		forEachCell(bounds, [&](int32_t x, int32_t y) {
+			auto cell = cells.find(cellKey(x, y));
+
+			if (cell != cells.end()) {
+				auto it = std::find(cell->second.begin(), cell->second.end(), id);
+
+				if (it != cell->second.end()) {
+					*it = cell->second.back();
+					cell->second.pop_back();
+				}
+			}
+		});
+	}
+
+	/**
+	 * @fn	void SpatialGrid::clear()
+	 *
+	 * @brief	Removes all items
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void clear() {
+		cells.clear();
+	}
+
+	/**
+	 * @fn	template<class F> void SpatialGrid::query(const sf::FloatRect& area, F func) const
+	 *
+	 * @brief	Invokes func with the identifier of every item stored in a cell overlapping area.
+	 * 			Items spanning multiple cells may be reported more than once.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	F	Callable taking (std::size_t id).
+	 * @param	area	The area in world coordinates.
+	 * @param	func	The function to invoke.
+	 */
+
+	template<class F>
+	void query(const sf::FloatRect& area, F func) const {
+		forEachCell(area, [&](int32_t x, int32_t y) {
+			auto cell = cells.find(cellKey(x, y));
+
+			if (cell != cells.end()) {
+				for (std::size_t id : cell->second) {
+					func(id);
+				}
+			}
+		});
+	}
+};
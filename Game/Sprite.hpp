@@ -3,7 +3,6 @@
 #include <SFML/Graphics.hpp>
 
 #include "Serializable.hpp"
-#include "ClickableRectangle.hpp"
 
 /**
  * @enum	ResizeFace
@@ -28,11 +27,11 @@ enum class ResizeFace {
  * @date	1/31/2018
  */
 
-class Sprite : public ClickableRectangle, public Serializable {
+class Sprite : public virtual sf::RectangleShape, public Serializable {
 public:
 	void setSize(const sf::Vector2f& size) {
-		ClickableRectangle::setOrigin(size / 2.0f);
-		ClickableRectangle::setSize(size);
+		sf::RectangleShape::setOrigin(size / 2.0f);
+		sf::RectangleShape::setSize(size);
 	}
 
 	/**
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class	SpscQueue
+ *
+ * @brief	Fixed capacity queue between exactly one producer thread and one consumer thread, without locks.
+ *
+ * @detailed The producer only writes the tail and the consumer only writes the head, each publishes its index with release
+ * 			 ordering after touching the slot, so neither thread ever waits for the other. A full queue rejects new items.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ *
+ * @tparam	T			Type of the items, copied in and out.
+ * @tparam	Capacity	Amount of slots, one of which is always kept free.
+ */
+
+template<class T, std::size_t Capacity>
+class SpscQueue {
+	static_assert(Capacity >= 2, "An SpscQueue needs at least two slots");
+
+	/** @brief	The slots */
+	std::array<T, Capacity> items;
+
+	/** @brief	Index of the oldest item, written by the consumer */
+	std::atomic<std::size_t> head;
+
+	/** @brief	Index of the next free slot, written by the producer */
+	std::atomic<std::size_t> tail;
+
+public:
+
+	/**
+	 * @fn	SpscQueue::SpscQueue()
+	 *
+	 * @brief	Constructs an empty queue
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	SpscQueue() : head(0), tail(0) { }
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	/**
+	 * @fn	bool SpscQueue::push(const T& item)
+	 *
+	 * @brief	Appends an item, only to be called by the producer
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	item	The item.
+	 *
+	 * @return	False if the queue is full.
+	 */
+
+	bool push(const T& item) {
+		const std::size_t current = tail.load(std::memory_order_relaxed);
+		const std::size_t next = (current + 1) % Capacity;
+
+		if (next == head.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		items[current] = item;
+		tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @fn	const T* SpscQueue::front() const
+	 *
+	 * @brief	Gets the oldest item without removing it, only to be called by the consumer
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The item, nullptr if the queue is empty. Valid until SpscQueue::pop().
+	 */
+
+	const T* front() const {
+		const std::size_t current = head.load(std::memory_order_relaxed);
+
+		if (current == tail.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+
+		return &items[current];
+	}
+
+	/**
+	 * @fn	void SpscQueue::pop()
+	 *
+	 * @brief	Removes the oldest item, only to be called by the consumer after SpscQueue::front() returned one
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void pop() {
+		head.store((head.load(std::memory_order_relaxed) + 1) % Capacity, std::memory_order_release);
+	}
+};
@@ -1,6 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "AssetReference.hpp"
 
 /**
  * @class	State
@@ -14,6 +20,46 @@
 class State {
 	/** @brief	Name of the State, used for doing transitions towards this state */
 	const std::string name;
+
+	/** @brief	Assets declared by this state using State::requireAsset, held until the state has been left */
+	std::vector<AssetReference> requiredAssets;
+
+protected:
+
+	/**
+	 * @fn	void State::requireAsset(const std::string& id)
+	 *
+	 * @brief	Declares an asset this state needs while it is active, usually called from State::entry().
+	 * 			The reference is dropped once the statemachine has left the state.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotLoadedException	Thrown when the asset was never loaded.
+	 *
+	 * @param	id	The asset identifier.
+	 */
+
+	void requireAsset(const std::string& id) {
+		requiredAssets.emplace_back(id);
+	}
+
+	/**
+	 * @fn	void State::requireAsset(const std::string& id, const std::string& filename)
+	 *
+	 * @brief	Declares an asset this state needs while it is active, loading it from filename if needed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	id			The asset identifier.
+	 * @param	filename	Filename of the asset.
+	 */
+
+	void requireAsset(const std::string& id, const std::string& filename) {
+		requiredAssets.emplace_back(id, filename);
+	}
+
 public:
 
 	/**
@@ -53,6 +99,71 @@ public:
 
 	virtual void exit() { };
 
+	/**
+	 * @fn	virtual bool State::needsRedraw() const
+	 *
+	 * @brief	Query if the state has to be updated and drawn this frame.
+	 * 			States that only change in response to input return false while nothing changed,
+	 * 			the main loop then waits for events instead of rendering the same frame again.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if the state changed or is animating.
+	 */
+
+	virtual bool needsRedraw() const {
+		return true;
+	}
+
+	/**
+	 * @fn	virtual sf::Time State::getIdleTimeout() const
+	 *
+	 * @brief	Gets how long the main loop may wait for events while the state does not need a redraw.
+	 * 			States with timers return the time until their next timer expires.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The timeout, sf::Time::Zero to wait until the next event.
+	 */
+
+	virtual sf::Time getIdleTimeout() const {
+		return sf::Time::Zero;
+	}
+
+	/**
+	 * @fn	virtual bool State::restart()
+	 *
+	 * @brief	Puts the state back in the condition it was constructed in, without reconstructing it.
+	 * 			Only called while the state is not the current state.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	False if the state cannot restart itself, the statemachine then reconstructs it.
+	 */
+
+	virtual bool restart() {
+		return false;
+	}
+
+	/**
+	 * @fn	std::vector<AssetReference> State::takeRequiredAssets()
+	 *
+	 * @brief	Takes all references declared with State::requireAsset out of this state.
+	 * 			The statemachine holds on to them until the next state has been entered, so assets shared by both states stay resident.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The references that were held by this state.
+	 */
+
+	std::vector<AssetReference> takeRequiredAssets() {
+		return std::move(requiredAssets);
+	}
+
 	/**
 	 * @fn	friend bool State::operator==(std::unique_ptr<State>& state, const std::string& name)
 	 *
@@ -2,9 +2,16 @@
 
 #include <SFML/Graphics.hpp>
 #include <map>
+#include <algorithm>
 #include <string>
+#include <memory>
+#include <future>
 
 #include "State.hpp"
+#include "AssetManager.hpp"
+#include "AssetReference.hpp"
+#include "RenderList.hpp"
+#include "RenderThread.hpp"
 #include "Events.hpp"
 #include "BaseFactory.hpp"
 #include "StatemachineException.hpp"
@@ -17,13 +24,14 @@
  * 			Allows for transitioning between states.
  * 			Calls entry and exit on the related states.
  * 			Also allows for completely resetting states using destructors and constructors.
+ * 			States are constructed when they are first entered, or ahead of time on a worker thread using Statemachine::prewarmState().
  *
  * @author	Julian
  * @date	2018-01-22
  */
 
 class Statemachine {
-	/** @brief	Available states to do transitions towards. */
+	/** @brief	Available states to do transitions towards, nullptr for states that have not been constructed yet. */
 	std::map<std::string, std::unique_ptr<State>> states;
 
 	/** @brief	The current state. */
@@ -32,12 +40,73 @@ class Statemachine {
 	/** @brief	The state factory. Used for constructing states by name. */
 	BaseFactory<State*, std::string> stateFactory;
 
+	/** @brief	States that are being constructed on a worker thread, see Statemachine::prewarmState(). */
+	std::map<std::string, std::future<std::unique_ptr<State>>> prewarming;
+
+	/** @brief	True if the next frame has to be drawn regardless of State::needsRedraw(). */
+	bool redrawRequested = true;
+
+	/** @brief	Renders the dynamic resolution passes of the recorded frames. */
+	DynamicResolution resolution;
+
+	/** @brief	Renders the recorded frames when enabled, nullptr if frames are rendered by Statemachine::update(). */
+	std::unique_ptr<RenderThread> renderThread;
+
+	/** @brief	The frame last rendered by Statemachine::update() while there is no render thread. */
+	RenderList::Frame lastFrame;
+
+	/** @brief	Image of the last frame of a state, see Statemachine::freezeFrame(). */
+	sf::RenderTexture frozenFrame;
+
+	/** @brief	True if frozenFrame holds an image. */
+	bool frozen = false;
+
+	/**
+	 * @fn	State& Statemachine::getState(const std::string& name)
+	 *
+	 * @brief	Gets the state identified by name, constructing it if needed.
+	 * 			A prewarmed instance is taken over, waiting for its construction to finish.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	InvalidStateException	Thrown when name is not a registered state.
+	 *
+	 * @param	name	The name of the state.
+	 *
+	 * @return	The state.
+	 */
+
+	State& getState(const std::string& name) {
+		auto it = states.find(name);
+
+		if (it == states.end()) {
+			throw InvalidStateException();
+		}
+
+		if (!it->second) {
+			auto prewarmed = prewarming.find(name);
+
+			if (prewarmed != prewarming.end()) {
+				std::future<std::unique_ptr<State>> future = std::move(prewarmed->second);
+				prewarming.erase(prewarmed);
+
+				it->second = future.get();
+			}
+			else {
+				it->second = std::unique_ptr<State>(stateFactory.create(name));
+			}
+		}
+
+		return *it->second;
+	}
+
 public:
 
 	/**
 	 * @fn	template<class T> void Statemachine::registerState(const std::string& name)
 	 *
-	 * @brief	Registers state class T with a name
+	 * @brief	Registers state class T with a name, T is constructed when it is first entered or prewarmed
 	 *
 	 * @author	Julian
 	 * @date	2018-01-22
@@ -64,12 +133,15 @@ public:
 			return new T(*this);
 		});
 
-		addState(name, *stateFactory.create(name));
+		states[name] = nullptr;
 	}
 
 	/** @brief	The window to render to. */
 	sf::RenderWindow& window;
 
+	/** @brief	The render list the states draw into, rendered to the window at the end of Statemachine::update(). */
+	RenderList renderList;
+
 	/**
 	 * @fn	Statemachine::Statemachine(sf::RenderWindow& window)
 	 *
@@ -81,7 +153,106 @@ public:
 	 * @param [in,out]	window	The render window to apply rendering to.
 	 */
 
-	Statemachine(sf::RenderWindow& window) : window(window) { }
+	Statemachine(sf::RenderWindow& window) : window(window), renderList(window.getSize()) { }
+
+	/**
+	 * @fn	Statemachine::~Statemachine()
+	 *
+	 * @brief	Destructor, waits for the states that are being prewarmed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	~Statemachine() {
+		prewarming.clear();
+	}
+
+	/**
+	 * @fn	void Statemachine::prewarmState(const std::string& name)
+	 *
+	 * @brief	Starts constructing a fresh instance of the state identified by name on a worker thread.
+	 * 			The instance is taken over when the state is entered before it has been constructed, or after Statemachine::resetState().
+	 * 			Constructors of prewarmed states may only load assets and build their own objects, they may not connect to events.
+	 * 			They run while the current state keeps updating: they may store references to the statemachine and its render list but
+	 * 			not use them, and have to take every asset through an AssetReference before getting it, so the current state cannot unload it.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	InvalidStateException	Thrown when name is not a registered state.
+	 *
+	 * @param	name	The name of the state.
+	 */
+
+	void prewarmState(const std::string& name) {
+		if (states.find(name) == states.end()) {
+			throw InvalidStateException();
+		}
+
+		if (prewarming.find(name) != prewarming.end()) {
+			return;
+		}
+
+		prewarming[name] = std::async(std::launch::async, [this, name]() {
+			// Textures are loaded on this thread, which requires an active OpenGL context.
+			sf::Context context;
+
+			return std::unique_ptr<State>(stateFactory.create(name));
+		});
+	}
+
+	/**
+	 * @fn	void Statemachine::setRenderThreadEnabled(bool enabled)
+	 *
+	 * @brief	Enables or disables rendering the frames on a RenderThread.
+	 * 			While enabled, the next frame is simulated while the previous one is rendered and presented.
+	 * 			Has to be disabled before the window is closed.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	enabled	True to render on a separate thread.
+	 */
+
+	void setRenderThreadEnabled(bool enabled) {
+		if (enabled && !renderThread) {
+			renderThread.reset(new RenderThread(window, &resolution));
+		}
+		else if (!enabled) {
+			renderThread.reset();
+		}
+	}
+
+	/**
+	 * @fn	void Statemachine::close()
+	 *
+	 * @brief	Stops the render thread and closes the window
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void close() {
+		setRenderThreadEnabled(false);
+		window.close();
+	}
+
+	/**
+	 * @fn	void Statemachine::finishRendering()
+	 *
+	 * @brief	Blocks until every submitted frame has been rendered.
+	 * 			Call this before destroying textures that were drawn in earlier frames.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void finishRendering() {
+		if (renderThread) {
+			renderThread->finish();
+		}
+	}
 
 	/**
 	 * @fn	void Statemachine::addState(State& gameState)
@@ -103,7 +274,7 @@ public:
 	 *
 	 * @brief	Resets the state identified by name.
 	 * 			The reset is done using the stateFactory.
-	 * 			This is done by destructing the state and constructing a new one and update the pointers.
+	 * 			This is done by destructing the state, a new one is constructed or a prewarmed one taken over when the state is entered again.
 	 *
 	 * @author	Julian
 	 * @date	2018-01-22
@@ -117,18 +288,47 @@ public:
 		auto it = states.find(name); // requires: operator==(std::unique_ptr<State>&, const std::string&)
 
 		if (it != states.end()) {
+			// Frames that are still being rendered may use the textures of the old state.
+			finishRendering();
+
 			it->second.reset();
-			it->second = std::move(std::unique_ptr<State>(stateFactory.create(name)));
 		} else { // 'name' not a registered state
 			throw InvalidStateException();
 		}
 	}
 
+	/**
+	 * @fn	void Statemachine::restartState(const std::string& name)
+	 *
+	 * @brief	Puts the state identified by name back in its initial condition.
+	 * 			States that implement State::restart() restore themselves in place, other states are reset with Statemachine::resetState().
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	InvalidStateException	Thrown when name is not a registered state.
+	 *
+	 * @param	name	The name of the state to restart.
+	 */
+
+	void restartState(const std::string& name) {
+		auto it = states.find(name);
+
+		if (it == states.end()) {
+			throw InvalidStateException();
+		}
+
+		if (!it->second || !it->second->restart()) {
+			resetState(name);
+		}
+	}
+
 	/**
 	 * @fn	void Statemachine::doTransition(const std::string& name)
 	 *
 	 * @brief	Executes a transition to the state with the specified name.
 	 * 			Executes State::exit() on the leaving state and State::entry() on the entering state.
+	 * 			Afterwards the assets of the leaving state are released and the AssetManager trims its resident set.
 	 *
 	 * @author	Julian
 	 * @date	2018-01-19
@@ -139,24 +339,156 @@ public:
 	 */
 
 	void doTransition(const std::string& name) {
+		// Assets of the leaving state are released only after entering the new one, so shared assets are not reloaded.
+		std::vector<AssetReference> previousAssets;
+
 		if (currentState != nullptr) {
 			currentState->exit();
+			previousAssets = currentState->takeRequiredAssets();
 		}
 
-		auto it = states.find(name); // requires: operator==(std::unique_ptr<State>&, const std::string&)
+		currentState = &getState(name);
+		currentState->entry();
 
-		if (it != states.end()) {
-			currentState = &(*it->second); // dereference iterator to get unique_ptr<State>, dereference unique_ptr<State> to get State, get address of State to store
-			currentState->entry();
-		} else { // 'name' not a registered state
-			throw InvalidStateException();
+		// The frame being recorded by the leaving state is dropped, it may use the assets that are released below.
+		renderList.clear();
+		lastFrame.clear();
+		finishRendering();
+
+		previousAssets.clear();
+		AssetManager::instance()->collect();
+
+		redrawRequested = true;
+	}
+
+	/**
+	 * @fn	bool Statemachine::freezeFrame()
+	 *
+	 * @brief	Renders the last rendered frame into a texture once, so the following states can show it with Statemachine::drawFrozenFrame()
+	 * 			instead of drawing the scene again. Call this from State::exit() of the state whose frame has to be kept.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	False if the texture could not be created.
+	 */
+
+	bool freezeFrame() {
+		const RenderList::Frame& frame = renderThread ? renderThread->getLastFrame() : lastFrame;
+		const sf::Vector2u size = window.getSize();
+
+		frozen = frozenFrame.getSize() == size || frozenFrame.create(size.x, size.y);
+
+		if (frozen) {
+			frozenFrame.clear();
+			frame.render(frozenFrame);
+			frozenFrame.display();
+		}
+
+		return frozen;
+	}
+
+	/**
+	 * @fn	bool Statemachine::drawFrozenFrame(const sf::Color& tint = sf::Color::White)
+	 *
+	 * @brief	Draws the image captured by Statemachine::freezeFrame() over the whole window as a single textured quad
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	tint	(Optional) Multiplied with the image, a grey dims it.
+	 *
+	 * @return	False if no frame has been frozen.
+	 */
+
+	bool drawFrozenFrame(const sf::Color& tint = sf::Color::White) {
+		if (!frozen) {
+			return false;
+		}
+
+		const sf::Vector2f size(frozenFrame.getSize());
+		const sf::View view = renderList.getView();
+
+		sf::Sprite sprite(frozenFrame.getTexture());
+		sprite.setColor(tint);
+
+		renderList.setView(sf::View(sf::FloatRect(0, 0, size.x, size.y)));
+		renderList.draw(sprite);
+		renderList.setView(view);
+
+		return true;
+	}
+
+	/**
+	 * @fn	void Statemachine::requestRedraw()
+	 *
+	 * @brief	Forces the next frame to be drawn, for instance after the window was resized or regained focus.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void requestRedraw() {
+		redrawRequested = true;
+	}
+
+	/**
+	 * @fn	bool Statemachine::needsRedraw() const
+	 *
+	 * @brief	Query if the next frame has to be updated and drawn.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if a redraw was requested or the current state needs one.
+	 */
+
+	bool needsRedraw() const {
+		return redrawRequested || currentState == nullptr || currentState->needsRedraw();
+	}
+
+	/**
+	 * @fn	bool Statemachine::waitEvent(sf::Event& ev)
+	 *
+	 * @brief	Blocks until an event arrives or the idle timeout of the current state expires.
+	 * 			SFML 2.4 has no timed sf::Window::waitEvent, so a timeout is waited out by polling in short sleeps.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [out]	ev	The received event.
+	 *
+	 * @return	True if ev holds an event, false if the timeout expired.
+	 */
+
+	bool waitEvent(sf::Event& ev) {
+		const sf::Time timeout = currentState != nullptr ? currentState->getIdleTimeout() : sf::Time::Zero;
+
+		if (timeout == sf::Time::Zero) {
+			return window.waitEvent(ev);
 		}
+
+		sf::Clock waited;
+
+		while (!window.pollEvent(ev)) {
+			const sf::Time remaining = timeout - waited.getElapsedTime();
+
+			if (remaining <= sf::Time::Zero) {
+				redrawRequested = true;
+				return false;
+			}
+
+			sf::sleep(std::min(remaining, sf::milliseconds(10)));
+		}
+
+		return true;
 	}
 
 	/**
 	* @fn	virtual void State::update(const float elapsedTime) = 0;
 	*
-	* @brief	Runs an update cycle for the current state
+	* @brief	Runs an update cycle for the current state.
+	* 			The state draws into renderList, which is then rendered to the window or handed to the RenderThread.
 	*
 	* @author	Julian
 	* @date	2018-01-19
@@ -165,8 +497,28 @@ public:
 	*/
 	
 	void update(const float elapsedTime) {
-		window.clear();
+		redrawRequested = false;
+
+		const State* updatedState = currentState;
+
+		renderList.setSize(window.getSize());
+		renderList.clear();
 		currentState->update(elapsedTime);
-		window.display();
+
+		if (currentState != updatedState) {
+			// The state transitioned during its update, the recorded frame has been dropped; keep showing the previous one.
+			return;
+		}
+
+		if (renderThread) {
+			renderThread->submit(renderList);
+		}
+		else {
+			window.clear();
+			renderList.render(window, &resolution);
+			window.display();
+
+			renderList.swapFrame(lastFrame);
+		}
 	}
 };
\ No newline at end of file
@@ -0,0 +1,520 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "ChunkCache.hpp"
+#include "SpatialGrid.hpp"
+#include "RenderList.hpp"
+#include "Renderable.hpp"
+
+/**
+ * @class	StaticGeometry
+ *
+ * @brief	Batched renderer for level rectangles that do not move during play.
+ *
+ * @detailed Rectangles are grouped by texture and by the world region their center lies in.
+ * 			 Every group is baked into a single sf::VertexArray of quads, so a group costs one draw call
+ * 			 instead of one per rectangle. Texture coordinates are taken from the TextureRect of each rectangle,
+ * 			 a TextureRect larger than a repeated texture tiles the same way it does for sf::RectangleShape.
+ * 			 Overlapping rectangles keep the order they were added in: a rectangle that overlaps an earlier rectangle
+ * 			 of another group is put in a later layer, and the layers are drawn in order. Rectangles that do not overlap
+ * 			 share a layer, so a level only needs more draw calls where rectangles of different textures are stacked.
+ * 			 Besides shapes, plain quads can be added with StaticGeometry::addQuad(), for level blocks that are not sf::RectangleShape objects.
+ * 			 The batches are rebuilt when a rectangle is added, updated or erased, and only batches
+ * 			 overlapping the view of the render target are drawn; outlines are not rendered.
+ * 			 With chunk caching enabled the batches are rasterized into a ChunkCache instead, and only the
+ * 			 cached chunks overlapping the view are drawn.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class StaticGeometry : public sf::Drawable, public Renderable {
+	/** @brief	Identifies a batch: layer, texture, region column and region row */
+	using BatchKey = std::tuple<uint32_t, const sf::Texture*, int32_t, int32_t>;
+
+	/**
+	 * @struct	Batch
+	 *
+	 * @brief	A group of rectangles sharing a layer, texture and region.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Batch {
+		/** @brief	The layer, batches of a lower layer are drawn first */
+		uint32_t layer = 0;
+		/** @brief	The texture shared by the rectangles, nullptr if untextured */
+		const sf::Texture* texture = nullptr;
+		/** @brief	The baked quads, in the order the rectangles were added */
+		sf::VertexArray vertices = sf::VertexArray(sf::Quads);
+		/** @brief	Union of the global bounds of all shapes */
+		sf::FloatRect bounds;
+		/** @brief	Insertion order of the first rectangle, draw order within a layer */
+		std::size_t order = 0;
+	};
+
+	/** @brief	Width and height of a batch region in world units */
+	float regionSize;
+
+	/** @brief	The batches */
+	std::map<BatchKey, Batch> batches;
+
+	/**
+	 * @struct	Placement
+	 *
+	 * @brief	The quad of a rectangle and when it was added.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	struct Placement {
+		/** @brief	The rectangle, nullptr for a quad added with StaticGeometry::addQuad() */
+		const sf::RectangleShape* shape;
+		/** @brief	The texture, nullptr if untextured */
+		const sf::Texture* texture;
+		/** @brief	The quad in world coordinates when the rectangle was last added or updated */
+		std::array<sf::Vertex, 4> quad;
+		/** @brief	Insertion order of the rectangle, kept when it is updated */
+		std::size_t order;
+		/** @brief	Global bounds of the rectangle when it was last added or updated */
+		sf::FloatRect bounds;
+	};
+
+	/** @brief	The placement of each rectangle, keyed by the rectangle as drawable */
+	std::map<const sf::Drawable*, Placement> keys;
+
+	/** @brief	The quads added with StaticGeometry::addQuad() */
+	std::vector<Placement> quads;
+
+	/** @brief	Cache of rasterized chunks, nullptr if chunk caching is disabled */
+	std::unique_ptr<ChunkCache> chunkCache;
+
+	/** @brief	True if the chunks overlapping the prepared view are cached, false if the batches are drawn instead */
+	bool chunksPrepared = false;
+
+	/** @brief	The batches sorted by draw order */
+	std::vector<const Batch*> drawOrder;
+
+	/** @brief	Insertion counter */
+	std::size_t insertions = 0;
+
+	/** @brief	True if the batches have to be rebuilt */
+	bool dirty = false;
+
+	/**
+	 * @fn	BatchKey StaticGeometry::getKey(uint32_t layer, const Placement& placement) const
+	 *
+	 * @brief	Gets the batch key of a rectangle from its layer, texture and center
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	layer	 	The layer.
+	 * @param	placement	The rectangle.
+	 *
+	 * @return	The batch key.
+	 */
+
+	BatchKey getKey(uint32_t layer, const Placement& placement) const {
+		const sf::FloatRect& bounds = placement.bounds;
+
+		return BatchKey(
+			layer,
+			placement.texture,
+			static_cast<int32_t>(std::floor((bounds.left + bounds.width / 2) / regionSize)),
+			static_cast<int32_t>(std::floor((bounds.top + bounds.height / 2) / regionSize))
+		);
+	}
+
+	/**
+	 * @fn	static Placement StaticGeometry::place(const sf::RectangleShape& shape, std::size_t order)
+	 *
+	 * @brief	Captures the quad of a rectangle in world coordinates
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	shape	The rectangle.
+	 * @param	order	The insertion order.
+	 *
+	 * @return	The placement.
+	 */
+
+	static Placement place(const sf::RectangleShape& shape, std::size_t order) {
+		const sf::Transform& transform = shape.getTransform();
+		const sf::Vector2f size = shape.getSize();
+		const sf::FloatRect uv = static_cast<sf::FloatRect>(shape.getTextureRect());
+		const sf::Color color = shape.getFillColor();
+
+		return {
+			&shape,
+			shape.getTexture(),
+			{ {
+				sf::Vertex(transform.transformPoint(0, 0), color, { uv.left, uv.top }),
+				sf::Vertex(transform.transformPoint(size.x, 0), color, { uv.left + uv.width, uv.top }),
+				sf::Vertex(transform.transformPoint(size.x, size.y), color, { uv.left + uv.width, uv.top + uv.height }),
+				sf::Vertex(transform.transformPoint(0, size.y), color, { uv.left, uv.top + uv.height })
+			} },
+			order,
+			shape.getGlobalBounds()
+		};
+	}
+
+	/**
+	 * @fn	template<class Target> void StaticGeometry::drawBatches(Target& target, sf::RenderStates states) const
+	 *
+	 * @brief	Draws the batches overlapping the view of target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @tparam	Target	sf::RenderTarget or RenderList.
+	 * @param [in,out]	target	The render target.
+	 * @param 		  	states	The render states.
+	 */
+
+	template<class Target>
+	void drawBatches(Target& target, sf::RenderStates states) const {
+		const sf::View& view = target.getView();
+		const sf::FloatRect viewRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+		for (const Batch* batch : drawOrder) {
+			if (batch->bounds.intersects(viewRect)) {
+				states.texture = batch->texture;
+				target.draw(batch->vertices, states);
+			}
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	StaticGeometry::StaticGeometry(float regionSize = 1024.0f)
+	 *
+	 * @brief	Constructor
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	regionSize	(Optional) Width and height of a batch region in world units.
+	 */
+
+	StaticGeometry(float regionSize = 1024.0f) : regionSize(regionSize) { }
+
+	/**
+	 * @fn	void StaticGeometry::add(const sf::RectangleShape& shape)
+	 *
+	 * @brief	Adds a rectangle. The rectangle must outlive this StaticGeometry or be erased first.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	shape	The rectangle.
+	 */
+
+	void add(const sf::RectangleShape& shape) {
+		keys[&shape] = place(shape, insertions++);
+		dirty = true;
+
+		if (chunkCache) {
+			chunkCache->invalidate(shape.getGlobalBounds());
+		}
+	}
+
+	/**
+	 * @fn	void StaticGeometry::addQuad(const sf::FloatRect& rect, const sf::Texture* texture, const sf::FloatRect& textureRect, const sf::Color& color)
+	 *
+	 * @brief	Adds a quad that is not backed by a shape. It is drawn the same way as a rectangle added at the same point,
+	 * 			but cannot be updated or erased.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	rect	   	The area in world coordinates.
+	 * @param	texture	   	The texture, nullptr if untextured.
+	 * @param	textureRect	Area of the texture to show, in texels.
+	 * @param	color	   	Multiplied with the texture.
+	 */
+
+	void addQuad(const sf::FloatRect& rect, const sf::Texture* texture, const sf::FloatRect& textureRect, const sf::Color& color) {
+		const sf::FloatRect& uv = textureRect;
+
+		quads.push_back({
+			nullptr,
+			texture,
+			{ {
+				sf::Vertex({ rect.left, rect.top }, color, { uv.left, uv.top }),
+				sf::Vertex({ rect.left + rect.width, rect.top }, color, { uv.left + uv.width, uv.top }),
+				sf::Vertex({ rect.left + rect.width, rect.top + rect.height }, color, { uv.left + uv.width, uv.top + uv.height }),
+				sf::Vertex({ rect.left, rect.top + rect.height }, color, { uv.left, uv.top + uv.height })
+			} },
+			insertions++,
+			rect
+		});
+		dirty = true;
+
+		if (chunkCache) {
+			chunkCache->invalidate(rect);
+		}
+	}
+
+	/**
+	 * @fn	bool StaticGeometry::contains(const sf::Drawable& drawable) const
+	 *
+	 * @brief	Query if drawable has been added to this StaticGeometry
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	drawable	The drawable.
+	 *
+	 * @return	True if drawable is rendered by this StaticGeometry.
+	 */
+
+	bool contains(const sf::Drawable& drawable) const {
+		return keys.find(&drawable) != keys.end();
+	}
+
+	/**
+	 * @fn	void StaticGeometry::update(const sf::Drawable& drawable)
+	 *
+	 * @brief	Rebuilds the batches after a rectangle has been moved, resized or retextured, the rectangle keeps its place in the draw order
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	drawable	The rectangle.
+	 */
+
+	void update(const sf::Drawable& drawable) {
+		auto key = keys.find(&drawable);
+
+		if (key != keys.end()) {
+			if (chunkCache) {
+				chunkCache->invalidate(key->second.bounds);
+			}
+
+			key->second = place(*key->second.shape, key->second.order);
+			dirty = true;
+
+			if (chunkCache) {
+				chunkCache->invalidate(key->second.bounds);
+			}
+		}
+	}
+
+	/**
+	 * @fn	void StaticGeometry::erase(const sf::Drawable& drawable)
+	 *
+	 * @brief	Erases a rectangle
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	drawable	The rectangle.
+	 */
+
+	void erase(const sf::Drawable& drawable) {
+		auto key = keys.find(&drawable);
+
+		if (key != keys.end()) {
+			if (chunkCache) {
+				chunkCache->invalidate(key->second.bounds);
+			}
+
+			keys.erase(key);
+			dirty = true;
+		}
+	}
+
+	/**
+	 * @fn	void StaticGeometry::rebuild()
+	 *
+	 * @brief	Rebuilds the batches if a rectangle was added, updated or erased since the last rebuild
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void rebuild() {
+		if (!dirty) {
+			return;
+		}
+
+		std::vector<const Placement*> placements;
+		placements.reserve(keys.size() + quads.size());
+
+		for (const auto& entry : keys) {
+			placements.push_back(&entry.second);
+		}
+
+		for (const Placement& quad : quads) {
+			placements.push_back(&quad);
+		}
+
+		std::sort(placements.begin(), placements.end(), [](const Placement* lhs, const Placement* rhs) {
+			return lhs->order < rhs->order;
+		});
+
+		batches.clear();
+
+		// The rectangles added so far, to find the earlier rectangles a rectangle overlaps.
+		SpatialGrid placed(regionSize / 4);
+		std::vector<BatchKey> placedKeys;
+		placedKeys.reserve(placements.size());
+
+		for (std::size_t i = 0; i < placements.size(); i++) {
+			const Placement& placement = *placements[i];
+			const BatchKey base = getKey(0, placement);
+			uint32_t layer = 0;
+
+			placed.query(placement.bounds, [&](std::size_t other) {
+				if (placements[other]->bounds.intersects(placement.bounds)) {
+					const BatchKey& otherKey = placedKeys[other];
+					const bool sameGroup = std::get<1>(otherKey) == std::get<1>(base) && std::get<2>(otherKey) == std::get<2>(base) && std::get<3>(otherKey) == std::get<3>(base);
+
+					// Within a batch rectangles are drawn in the order they were added, another batch has to be drawn later.
+					layer = std::max(layer, std::get<0>(otherKey) + (sameGroup ? 0 : 1));
+				}
+			});
+
+			const BatchKey key = getKey(layer, placement);
+			auto it = batches.find(key);
+
+			if (it == batches.end()) {
+				it = batches.emplace(key, Batch()).first;
+				it->second.layer = layer;
+				it->second.texture = placement.texture;
+				it->second.order = placement.order;
+			}
+
+			for (const sf::Vertex& vertex : placement.quad) {
+				it->second.vertices.append(vertex);
+			}
+
+			placed.insert(i, placement.bounds);
+			placedKeys.push_back(key);
+		}
+
+		drawOrder.clear();
+
+		for (auto& entry : batches) {
+			entry.second.bounds = entry.second.vertices.getBounds();
+			drawOrder.push_back(&entry.second);
+		}
+
+		std::sort(drawOrder.begin(), drawOrder.end(), [](const Batch* lhs, const Batch* rhs) {
+			return lhs->layer != rhs->layer ? lhs->layer < rhs->layer : lhs->order < rhs->order;
+		});
+
+		dirty = false;
+	}
+
+	/**
+	 * @fn	void StaticGeometry::prepare(const sf::View& view)
+	 *
+	 * @brief	Rebuilds changed batches and, with chunk caching enabled, rasterizes the uncached chunks overlapping view.
+	 * 			When the chunks overlapping view do not fit in the chunk budget the batches are drawn instead.
+	 * 			Must be called before drawing with view.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	view	The view that will be drawn.
+	 */
+
+	void prepare(const sf::View& view) {
+		rebuild();
+
+		chunksPrepared = chunkCache && chunkCache->prepare(view, [this](sf::RenderTarget& target) {
+			drawBatches(target, sf::RenderStates::Default);
+		});
+	}
+
+	/**
+	 * @fn	void StaticGeometry::setChunkCaching(bool enabled, unsigned chunkSize = 512, std::size_t budget = 32 * 1024 * 1024)
+	 *
+	 * @brief	Enables or disables drawing through pre-rendered chunks
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	enabled  	True to draw through pre-rendered chunks.
+	 * @param	chunkSize	(Optional) Width and height of a chunk in world units.
+	 * @param	budget   	(Optional) Maximum amount of bytes used by the chunk textures.
+	 */
+
+	void setChunkCaching(bool enabled, unsigned chunkSize = 512, std::size_t budget = 32 * 1024 * 1024) {
+		if (enabled) {
+			chunkCache.reset(new ChunkCache(chunkSize, budget));
+		}
+		else {
+			chunkCache.reset();
+		}
+
+		chunksPrepared = false;
+	}
+
+	/**
+	 * @fn	std::size_t StaticGeometry::getBatchCount() const
+	 *
+	 * @brief	Gets the amount of batches, which is the maximum amount of draw calls per frame
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The batch count.
+	 */
+
+	std::size_t getBatchCount() const {
+		return batches.size();
+	}
+
+	/**
+	 * @fn	void StaticGeometry::draw(sf::RenderTarget& target, sf::RenderStates states) const override
+	 *
+	 * @brief	Draws the batches or cached chunks overlapping the view of target. StaticGeometry::prepare() must have been called with the same view.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The render target.
+	 * @param 		  	states	The render states.
+	 */
+
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override {
+		RenderList::drawTo(target, *this, states);
+	}
+
+	/**
+	 * @fn	void StaticGeometry::draw(RenderList& target, sf::RenderStates states) const override
+	 *
+	 * @brief	Records the batches or cached chunks overlapping the view of target. StaticGeometry::prepare() must have been called with the same view.
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The render list.
+	 * @param 		  	states	The render states.
+	 */
+
+	void draw(RenderList& target, sf::RenderStates states) const override {
+		if (chunksPrepared) {
+			chunkCache->draw(target, states);
+		}
+		else {
+			drawBatches(target, states);
+		}
+	}
+};
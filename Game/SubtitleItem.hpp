@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 
 /**
  * @class	SubtitleItem
@@ -15,19 +16,19 @@ class SubtitleItem {
 private:
 
 	/** @brief	The subtitle number */
-	const int subtitleNumber;
+	int subtitleNumber;
 
 
 	/** @brief	The subtitle text */
 	std::string text;
 
 	/**
-	 * @property	std::string timeStart, timeEnd
+	 * @property	int32_t start, end
 	 *
-	 * @brief	Subtitle start and end timers.
+	 * @brief	Subtitle start and end times in milliseconds since the start of the subtitles.
 	 */
 
-	std::string timeStart, timeEnd;
+	int32_t start, end;
 
 	/** @brief	The image */
 	std::string image;
@@ -35,7 +36,7 @@ private:
 public:
 
 	/**
-	 * @fn	SubtitleItem::SubtitleItem(int subtitleNumber, std::string text, std::string timeStart, std::string timeEnd)
+	 * @fn	SubtitleItem::SubtitleItem(int subtitleNumber, std::string text, std::string image, int32_t start, int32_t end)
 	 *
 	 * @brief	Constructor
 	 *
@@ -44,16 +45,17 @@ public:
 	 *
 	 * @param	subtitleNumber	The subtitle number.
 	 * @param	text		  	The subtitle text.
-	 * @param	timeStart	  	The subtitle time start.
-	 * @param	timeEnd		  	The subtitle time end.
+	 * @param	image		  	The image path, "NONE" to hide the image or empty to keep the previous one.
+	 * @param	start		  	The subtitle start time in milliseconds.
+	 * @param	end			  	The subtitle end time in milliseconds.
 	 */
 
-	SubtitleItem(int subtitleNumber, std::string text, std::string image, std::string timeStart, std::string timeEnd) :
+	SubtitleItem(int subtitleNumber, std::string text, std::string image, int32_t start, int32_t end) :
 		subtitleNumber(subtitleNumber),
 		text(text),
 		image(image),
-		timeStart(timeStart),
-		timeEnd(timeEnd)
+		start(start),
+		end(end)
 	{};
 
 	/**
@@ -87,33 +89,33 @@ public:
 	}
 
 	/**
-	 * @fn	std::string SubtitleItem::getTimeStart() const
+	 * @fn	int32_t SubtitleItem::getStart() const
 	 *
-	 * @brief	Gets subtitle time start
+	 * @brief	Gets subtitle start time
 	 *
 	 * @author	Wiebe
 	 * @date	24-1-2018
 	 *
-	 * @return	The subtitle time start.
+	 * @return	The subtitle start time in milliseconds.
 	 */
 
-	std::string getTimeStart() const {
-		return timeStart;
+	int32_t getStart() const {
+		return start;
 	}
 
 	/**
-	 * @fn	std::string SubtitleItem::getTimeEnd() const
+	 * @fn	int32_t SubtitleItem::getEnd() const
 	 *
-	 * @brief	Gets subtitloe time end
+	 * @brief	Gets subtitle end time
 	 *
 	 * @author	Wiebe
 	 * @date	24-1-2018
 	 *
-	 * @return	The subtitle time end.
+	 * @return	The subtitle end time in milliseconds.
 	 */
 
-	std::string getTimeEnd() const {
-		return timeEnd;
+	int32_t getEnd() const {
+		return end;
 	}
 
 	/**
@@ -4,21 +4,25 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 #include "SubtitleReadException.hpp"
 #include "SubtitleItem.hpp"
 
 /**
- * @typedef	std::vector<std::shared_ptr<SubtitleItem>> SubtitleVector
+ * @typedef	std::vector<SubtitleItem> SubtitleVector
  *
- * @brief	Defines an alias representing the subtitle vector
+ * @brief	Defines an alias representing the subtitle vector, sorted by start time
  */
 
-typedef std::vector<std::shared_ptr<SubtitleItem>> SubtitleVector;
+typedef std::vector<SubtitleItem> SubtitleVector;
 
 /**
  * @class	SubtitleParser
  *
  * @brief	A subtitle parser.
+ * 			Compiles an .srt file into cues with millisecond start and end times, so playing them back needs no string processing.
  *
  * @author	Wiebe
  * @date	24-1-2018
@@ -29,17 +33,46 @@ private:
 	/** @brief	Subtitle file filepath */
 	const std::string filepath;
 
+	/**
+	 * @fn	int32_t SubtitleParser::parseTimestamp(const std::string& timestamp) const
+	 *
+	 * @brief	Parses an .srt timestamp of the form hours:minutes:seconds,milliseconds, the milliseconds are optional
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	SubtitleReadException	Thrown when timestamp is malformed.
+	 *
+	 * @param	timestamp	The timestamp.
+	 *
+	 * @return	The time in milliseconds.
+	 */
 
-	/** @brief	The file stream */
-	std::ifstream fileStream;
+	int32_t parseTimestamp(const std::string& timestamp) const {
+		std::istringstream stream(timestamp);
+		int32_t hours, minutes, seconds, milliseconds = 0;
+		char separator1, separator2, separator3;
+
+		if (!(stream >> hours >> separator1 >> minutes >> separator2 >> seconds) || separator1 != ':' || separator2 != ':') {
+			throw SubtitleReadException(filepath);
+		}
+
+		if (stream >> separator3) {
+			if ((separator3 != ',' && separator3 != '.') || !(stream >> milliseconds)) {
+				throw SubtitleReadException(filepath);
+			}
+		}
+
+		return ((hours * 60 + minutes) * 60 + seconds) * 1000 + milliseconds;
+	}
 
 public:
-	SubtitleParser(const std::string filepath) : filepath(filepath), fileStream(filepath) {};
+	SubtitleParser(const std::string filepath) : filepath(filepath) {};
 
 	/**
 	 * @fn	SubtitleVector& SubtitleParser::parse(SubtitleVector& subtitles)
 	 *
-	 * @brief	Parses an subtitle file and saves the individual SubtitleItem instances into an SubtitleVector 
+	 * @brief	Parses an subtitle file and saves the individual SubtitleItem instances into an SubtitleVector, sorted by start time
 	 *
 	 * @author	Wiebe
 	 * @date	24-1-2018
@@ -52,12 +85,16 @@ public:
 	 */
 
 	SubtitleVector& parse(SubtitleVector& subtitles) {
+		std::ifstream fileStream(filepath);
+
 		if (!fileStream.is_open()) {
 			throw SubtitleReadException(filepath);
 		}
 
-		std::string line, start, end, completeLine = "", timeLine = "", imageLine = "";
+		std::string line, completeLine = "", imageLine = "";
+		int32_t start = 0, end = 0;
 		int subtitleNumber = 0, turn = 0;
+		bool timed = false;
 
 		/*
 		* turn = 0 -> Add subtitle number
@@ -65,6 +102,15 @@ public:
 		* turn > 1 -> Add string to completeLine
 		*/
 
+		auto addItem = [&]() {
+			if (timed) {
+				subtitles.emplace_back(subtitleNumber, completeLine, imageLine, start, end);
+			}
+
+			completeLine = imageLine = "";
+			timed = false;
+		};
+
 		while (std::getline(fileStream, line)) {
 			line.erase(remove(line.begin(), line.end(), '\r'), line.end());
 
@@ -76,13 +122,16 @@ public:
 				}
 
 				if (line.find("-->") != std::string::npos) {
-					timeLine += line;
-
 					std::vector<std::string> srtTime;
-					srtTime = split(timeLine, ' ', srtTime);
+					srtTime = split(line, ' ', srtTime);
+
+					if (srtTime.size() < 3) {
+						throw SubtitleReadException(filepath);
+					}
 
-					start = srtTime[0];
-					end = srtTime[2];
+					start = parseTimestamp(srtTime[0]);
+					end = parseTimestamp(srtTime[2]);
+					timed = true;
 				}
 				else if (line.find("#~") != std::string::npos) {
 					imageLine += line;
@@ -99,18 +148,15 @@ public:
 			}
 			else {
 				turn = 0;
-
-				subtitles.push_back(std::make_shared<SubtitleItem>(subtitleNumber, completeLine, imageLine, start, end));
-				completeLine = timeLine = imageLine = "";
-			}
-
-			if (fileStream.eof()) {
-				subtitles.push_back(std::make_shared<SubtitleItem>(subtitleNumber, completeLine, imageLine, start, end));
+				addItem();
 			}
 		}
 
-		// Close file
-		fileStream.close();
+		addItem();
+
+		std::stable_sort(subtitles.begin(), subtitles.end(), [](const SubtitleItem& lhs, const SubtitleItem& rhs) {
+			return lhs.getStart() < rhs.getStart();
+		});
 
 		return subtitles;
 	}
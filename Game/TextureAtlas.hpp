@@ -0,0 +1,138 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "AssetManager.hpp"
+
+/**
+ * @class	TextureAtlas
+ *
+ * @brief	Packs several textures of the AssetManager into a single texture.
+ *
+ * @detailed Drawing geometry that uses several small textures normally takes one draw call per texture.
+ * 			 After packing them into an atlas, the same geometry can be drawn in a single call by using
+ * 			 the region of each texture in the atlas as texture coordinates.
+ * 			 Textures are packed in rows, tallest first, with one transparent texel between them.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class TextureAtlas {
+	/** @brief	The packed texture */
+	sf::Texture texture;
+
+	/** @brief	Region of every packed texture, keyed by texture identifier */
+	std::map<std::string, sf::IntRect> regions;
+
+public:
+
+	/**
+	 * @fn	void TextureAtlas::build(const std::vector<std::string>& textureIds, unsigned maxWidth = 512)
+	 *
+	 * @brief	Packs the given textures into the atlas, replacing its previous contents
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @exception	AssetNotLoadedException	Thrown when one of the textures is not loaded.
+	 *
+	 * @param	textureIds	Identifiers of the textures to pack, duplicates are packed once.
+	 * @param	maxWidth  	(Optional) Maximum width of a row in texels.
+	 */
+
+	void build(const std::vector<std::string>& textureIds, unsigned maxWidth = 512) {
+		std::map<std::string, sf::Image> images;
+
+		for (const std::string& id : textureIds) {
+			if (images.find(id) == images.end()) {
+				images[id] = AssetManager::instance()->getTexture(id).copyToImage();
+			}
+		}
+
+		std::vector<const std::pair<const std::string, sf::Image>*> order;
+
+		for (const auto& image : images) {
+			order.push_back(&image);
+		}
+
+		std::sort(order.begin(), order.end(), [](const std::pair<const std::string, sf::Image>* lhs, const std::pair<const std::string, sf::Image>* rhs) {
+			return lhs->second.getSize().y > rhs->second.getSize().y;
+		});
+
+		regions.clear();
+
+		unsigned x = 0;
+		unsigned y = 0;
+		unsigned rowHeight = 0;
+		unsigned width = 0;
+
+		for (const auto* image : order) {
+			const sf::Vector2u size = image->second.getSize();
+
+			if (x > 0 && x + size.x > maxWidth) {
+				x = 0;
+				y += rowHeight + 1;
+				rowHeight = 0;
+			}
+
+			regions[image->first] = sf::IntRect(x, y, size.x, size.y);
+
+			x += size.x + 1;
+			rowHeight = std::max(rowHeight, size.y);
+			width = std::max(width, x);
+		}
+
+		sf::Image atlas;
+		atlas.create(std::max(width, 1u), std::max(y + rowHeight, 1u), sf::Color::Transparent);
+
+		for (const auto* image : order) {
+			const sf::IntRect& region = regions[image->first];
+			atlas.copy(image->second, region.left, region.top);
+		}
+
+		texture.loadFromImage(atlas);
+	}
+
+	/**
+	 * @fn	const sf::IntRect* TextureAtlas::find(const std::string& textureId) const
+	 *
+	 * @brief	Searches for the region of a packed texture
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	textureId	Identifier of the texture.
+	 *
+	 * @return	The region in the atlas, nullptr if the texture was not packed.
+	 */
+
+	const sf::IntRect* find(const std::string& textureId) const {
+		auto it = regions.find(textureId);
+
+		if (it == regions.end()) {
+			return nullptr;
+		}
+
+		return &it->second;
+	}
+
+	/**
+	 * @fn	const sf::Texture& TextureAtlas::getTexture() const
+	 *
+	 * @brief	Gets the packed texture
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The texture.
+	 */
+
+	const sf::Texture& getTexture() const {
+		return texture;
+	}
+};
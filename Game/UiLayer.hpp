@@ -0,0 +1,308 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+#include "Widget.hpp"
+#include "RenderList.hpp"
+
+/**
+ * @class	UiLayer
+ *
+ * @brief	Retained composition of widgets.
+ *
+ * @detailed The widgets are composed once into an sf::RenderTexture, every following draw only copies that texture
+ * 			 to the render target. When widgets change, only the areas they covered before and cover now are
+ * 			 cleared and recomposed; the view is clipped to such an area so widgets overlapping it are not blended twice.
+ * 			 The texture holds premultiplied alpha, so a layer with transparent areas can be drawn over other content.
+ * 			 Frames recorded earlier may still be rendered by a RenderThread, so the composition rotates through
+ * 			 UiLayer::textureCount textures and a recomposition never writes to a texture that a frame in flight samples.
+ * 			 @code{.cpp}
+ * 			   ui.add(startButton);
+ * 			   // every frame
+ * 			   ui.draw(window);
+ * 			 @endcode
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class UiLayer {
+	/** @brief	The widgets in draw order */
+	std::vector<Widget*> widgets;
+
+	/** @brief	Bounds of each widget when it was last composed */
+	std::vector<sf::FloatRect> composedBounds;
+
+	/** @brief	Amount of textures: the frame being recorded plus the pending and rendered frame of a RenderThread */
+	static const std::size_t textureCount = 3;
+
+	/** @brief	The composed widgets, textures[current] holds the latest composition */
+	std::array<sf::RenderTexture, textureCount> textures;
+
+	/** @brief	Index of the latest composition */
+	std::size_t current = 0;
+
+	/** @brief	True once the textures have been created */
+	bool created = false;
+
+	/** @brief	True if all widgets have to be recomposed */
+	bool invalidated = true;
+
+	/** @brief	The view the widgets were composed with */
+	sf::View composedView;
+
+	/** @brief	Blend mode that composes straight alpha widgets into premultiplied alpha */
+	const sf::BlendMode composeBlendMode = sf::BlendMode(
+		sf::BlendMode::SrcAlpha, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Add,
+		sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Add
+	);
+
+	/** @brief	Blend mode that draws the premultiplied composition */
+	const sf::BlendMode presentBlendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+	/**
+	 * @fn	static bool UiLayer::sameView(const sf::View& lhs, const sf::View& rhs)
+	 *
+	 * @brief	Compares the area and viewport of two views
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	lhs	The first view.
+	 * @param	rhs	The second view.
+	 *
+	 * @return	True if both views show the same area.
+	 */
+
+	static bool sameView(const sf::View& lhs, const sf::View& rhs) {
+		return lhs.getCenter() == rhs.getCenter() && lhs.getSize() == rhs.getSize() && lhs.getRotation() == rhs.getRotation() && lhs.getViewport() == rhs.getViewport();
+	}
+
+	/**
+	 * @fn	void UiLayer::composeAll()
+	 *
+	 * @brief	Clears the texture and composes all widgets
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void composeAll() {
+		sf::RenderTexture& texture = textures[current];
+
+		texture.setView(composedView);
+		texture.clear(sf::Color::Transparent);
+
+		for (std::size_t i = 0; i < widgets.size(); i++) {
+			texture.draw(*widgets[i], composeBlendMode);
+			composedBounds[i] = widgets[i]->getGlobalBounds();
+			widgets[i]->markClean();
+		}
+
+		invalidated = false;
+	}
+
+	/**
+	 * @fn	void UiLayer::compose(const sf::FloatRect& area)
+	 *
+	 * @brief	Clears area and composes the widgets overlapping it, clipped to area
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	area	The area in the coordinates of composedView.
+	 */
+
+	void compose(const sf::FloatRect& area) {
+		sf::RenderTexture& texture = textures[current];
+
+		texture.setView(composedView);
+
+		// Round the area outwards to whole texels, so the clipped view maps exactly onto texture texels.
+		const sf::Vector2i topLeft = texture.mapCoordsToPixel({ area.left, area.top });
+		const sf::Vector2i bottomRight = texture.mapCoordsToPixel({ area.left + area.width, area.top + area.height });
+		const sf::Vector2u size = texture.getSize();
+
+		const int left = std::max(0, std::min(topLeft.x, bottomRight.x) - 1);
+		const int top = std::max(0, std::min(topLeft.y, bottomRight.y) - 1);
+		const int right = std::min(static_cast<int>(size.x), std::max(topLeft.x, bottomRight.x) + 1);
+		const int bottom = std::min(static_cast<int>(size.y), std::max(topLeft.y, bottomRight.y) + 1);
+
+		if (right <= left || bottom <= top) {
+			return;
+		}
+
+		const sf::Vector2f worldTopLeft = texture.mapPixelToCoords({ left, top });
+		const sf::Vector2f worldBottomRight = texture.mapPixelToCoords({ right, bottom });
+		const sf::FloatRect clip(worldTopLeft, worldBottomRight - worldTopLeft);
+
+		sf::View clipped(clip);
+		clipped.setViewport(sf::FloatRect(
+			static_cast<float>(left) / size.x,
+			static_cast<float>(top) / size.y,
+			static_cast<float>(right - left) / size.x,
+			static_cast<float>(bottom - top) / size.y
+		));
+		texture.setView(clipped);
+
+		sf::RectangleShape eraser({ clip.width, clip.height });
+		eraser.setPosition(clip.left, clip.top);
+		eraser.setFillColor(sf::Color::Transparent);
+		texture.draw(eraser, sf::BlendNone);
+
+		for (Widget* widget : widgets) {
+			if (widget->getGlobalBounds().intersects(clip)) {
+				texture.draw(*widget, composeBlendMode);
+			}
+		}
+	}
+
+	/**
+	 * @fn	void UiLayer::advance(bool copy)
+	 *
+	 * @brief	Moves to the next texture, which is no longer used by any frame in flight
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param	copy	True to start from the latest composition, for recomposing only the changed areas.
+	 */
+
+	void advance(bool copy) {
+		const sf::Texture& previous = textures[current].getTexture();
+
+		current = (current + 1) % textureCount;
+
+		if (copy) {
+			sf::RenderTexture& texture = textures[current];
+			const sf::Vector2u size = texture.getSize();
+
+			texture.setView(sf::View(sf::FloatRect(0, 0, static_cast<float>(size.x), static_cast<float>(size.y))));
+			texture.draw(sf::Sprite(previous), sf::BlendNone);
+		}
+	}
+
+public:
+
+	/**
+	 * @fn	void UiLayer::add(Widget& widget)
+	 *
+	 * @brief	Adds a widget on top of the previously added widgets
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	widget	The widget, must outlive the layer.
+	 */
+
+	void add(Widget& widget) {
+		widgets.push_back(&widget);
+		composedBounds.push_back(sf::FloatRect());
+		invalidated = true;
+	}
+
+	/**
+	 * @fn	bool UiLayer::isDirty() const
+	 *
+	 * @brief	Query if the next draw has to recompose anything
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if the layer was invalidated or one of its widgets changed.
+	 */
+
+	bool isDirty() const {
+		return invalidated || !created || std::any_of(widgets.begin(), widgets.end(), [](const Widget* widget) {
+			return widget->isDirty();
+		});
+	}
+
+	/**
+	 * @fn	void UiLayer::invalidate()
+	 *
+	 * @brief	Recomposes all widgets on the next draw
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void invalidate() {
+		invalidated = true;
+	}
+
+	/**
+	 * @fn	void UiLayer::draw(RenderList& target)
+	 *
+	 * @brief	Recomposes changed widgets and draws the composition over target, using the current view of target
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @param [in,out]	target	The render list.
+	 */
+
+	void draw(RenderList& target) {
+		const sf::Vector2u size = target.getSize();
+
+		if (!created || textures[current].getSize() != size) {
+			created = std::all_of(textures.begin(), textures.end(), [&](sf::RenderTexture& texture) {
+				return texture.create(size.x, size.y);
+			});
+			invalidated = true;
+
+			if (!created) {
+				for (Widget* widget : widgets) {
+					target.draw(*widget);
+				}
+
+				return;
+			}
+		}
+
+		if (!sameView(composedView, target.getView())) {
+			composedView = target.getView();
+			invalidated = true;
+		}
+
+		if (invalidated) {
+			advance(false);
+			composeAll();
+			textures[current].display();
+		}
+		else {
+			bool changed = false;
+
+			for (std::size_t i = 0; i < widgets.size(); i++) {
+				if (widgets[i]->isDirty()) {
+					if (!changed) {
+						advance(true);
+					}
+
+					const sf::FloatRect bounds = widgets[i]->getGlobalBounds();
+
+					compose(composedBounds[i]);
+					compose(bounds);
+
+					composedBounds[i] = bounds;
+					widgets[i]->markClean();
+					changed = true;
+				}
+			}
+
+			if (changed) {
+				textures[current].display();
+			}
+		}
+
+		const sf::View previous = target.getView();
+
+		target.setView(sf::View(sf::FloatRect(0, 0, static_cast<float>(size.x), static_cast<float>(size.y))));
+		target.draw(sf::Sprite(textures[current].getTexture()), presentBlendMode);
+		target.setView(previous);
+	}
+};
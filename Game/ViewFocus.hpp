@@ -2,6 +2,7 @@
 
 #include "Body.hpp"
 #include "Player.hpp"
+#include "RenderList.hpp"
 
 /**
  * @class	ViewFocus
@@ -15,8 +16,8 @@
 class ViewFocus {
 	/** @brief	The view */
 	sf::View view;
-	/** @brief	The window */
-	sf::RenderWindow& window;
+	/** @brief	The render list the view is applied to */
+	RenderList& window;
 	/** @brief	The focus */
 	Body* focus;
 	/** @brief	The left border */
@@ -32,35 +33,35 @@ class ViewFocus {
 public:
 
 	/**
-	 * @fn	ViewFocus::ViewFocus(sf::RenderWindow& window, Body& physicsObject) : view(sf::Vector2f(150, 10), sf::Vector2f(1280, 720)), window(window), focus(&physicsObject)
+	 * @fn	ViewFocus::ViewFocus(RenderList& window, Body& physicsObject) : view(sf::Vector2f(150, 10), sf::Vector2f(1280, 720)), window(window), focus(&physicsObject)
 	 *
 	 * @brief	Constructs a view for window with a focus on physicsObject
 	 *
 	 * @author	Julian
 	 * @date	2018-01-19
 	 *
-	 * @param [in,out]	window		 	The window.
+	 * @param [in,out]	window		 	The render list.
 	 * @param [in,out]	physicsObject	The physics object.
 	 */
 
-	ViewFocus(sf::RenderWindow& window, Body& physicsObject) :
+	ViewFocus(RenderList& window, Body& physicsObject) :
 		view(sf::Vector2f(), sf::Vector2f(1280, 720)),
 		window(window),
 		focus(&physicsObject)
 	{ }
 
 	/**
-	 * @fn	ViewFocus::ViewFocus(sf::RenderWindow& window) : view(sf::Vector2f(150, 10), sf::Vector2f(1280, 720)), window(window), focus(nullptr)
+	 * @fn	ViewFocus::ViewFocus(RenderList& window) : view(sf::Vector2f(150, 10), sf::Vector2f(1280, 720)), window(window), focus(nullptr)
 	 *
 	 * @brief	Constructs a view for window without a focus.
 	 *
 	 * @author	Julian
 	 * @date	2018-01-19
 	 *
-	 * @param [in,out]	window	The window.
+	 * @param [in,out]	window	The render list.
 	 */
 
-	ViewFocus(sf::RenderWindow& window) :
+	ViewFocus(RenderList& window) :
 		view(sf::Vector2f(150, 10), sf::Vector2f(1280, 720)),
 		window(window),
 		focus(nullptr)
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "Renderable.hpp"
+
+/**
+ * @class	Widget
+ *
+ * @brief	A drawable user interface element that keeps track of changes to its appearance.
+ *
+ * @detailed Every setter that changes how a widget looks marks it dirty. A UiLayer uses this to recompose
+ * 			 only the widgets that changed since it last drew them. Widgets can also be recorded into a RenderList directly.
+ *
+ * @author	Julian
+ * @date	2026-10-19
+ */
+
+class Widget : public sf::Drawable, public Renderable {
+	/** @brief	True if the appearance changed since the widget was last composed */
+	bool dirty = true;
+
+protected:
+
+	/**
+	 * @fn	void Widget::markDirty()
+	 *
+	 * @brief	Marks the widget as changed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	void markDirty() {
+		dirty = true;
+	}
+
+public:
+
+	/**
+	 * @fn	virtual bool Widget::isDirty() const
+	 *
+	 * @brief	Query if the appearance changed since the widget was last composed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	True if dirty.
+	 */
+
+	virtual bool isDirty() const {
+		return dirty;
+	}
+
+	/**
+	 * @fn	virtual void Widget::markClean()
+	 *
+	 * @brief	Marks the widget as composed
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 */
+
+	virtual void markClean() {
+		dirty = false;
+	}
+
+	/**
+	 * @fn	virtual sf::FloatRect Widget::getGlobalBounds() const = 0;
+	 *
+	 * @brief	Gets the area the widget draws to
+	 *
+	 * @author	Julian
+	 * @date	2026-10-19
+	 *
+	 * @return	The global bounds.
+	 */
+
+	virtual sf::FloatRect getGlobalBounds() const = 0;
+};
@@ -1,3 +1,6 @@
+// Defined before the includes, the states check it as well.
+//#define ENABLE_DEBUG_MODE
+
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <iostream>
@@ -5,15 +8,15 @@
 #include "GameStates.hpp"
 #include "Events.hpp"
 #include "AssetManager.hpp"
+#include "AssetReference.hpp"
 #include "fimmyIcon.hpp"
 
-//#define ENABLE_DEBUG_MODE
-
 int main() {
 	// Game constants.
 	const float FPS = 60.0f;
 	const bool  ENABLE_CUTSCENE = true;
 	const bool  ENABLE_EDITOR = false;
+	const bool  ENABLE_RENDER_THREAD = true;
 
 	sf::RenderWindow window(sf::VideoMode(1280, 720, 32), "Fimmy the Game");
 
@@ -22,14 +25,17 @@ int main() {
 
 	window.setFramerateLimit(static_cast<unsigned int>(FPS));
 
-	game = Game(window);
-
-	// Load assets.
-	AssetManager::instance()->load("arial", "arial.ttf");
-
 	// Create an new statemachine.
 	Statemachine statemachine(window);
 
+	// Samples the keyboard on its own thread, so presses shorter than a frame reach the simulation.
+	InputSampler input;
+
+	game = Game(window, statemachine.renderList, input);
+
+	// Load assets, the default font stays resident for the lifetime of the game.
+	AssetReference defaultFont("arial", "arial.ttf");
+
 	// Set the default font.
 	Label::setDefaultFont(AssetManager::instance()->getFont("arial"));
 
@@ -42,6 +48,9 @@ int main() {
 	statemachine.registerState<SettingsMenu>("settings-menu");
 	statemachine.registerState<Cutscene>("cutscene");
 
+	// Render and present frames on a separate thread, so the next frame is simulated meanwhile.
+	statemachine.setRenderThreadEnabled(ENABLE_RENDER_THREAD);
+
 	if (ENABLE_EDITOR) {
 		statemachine.doTransition("map-editor");
 	}
@@ -60,15 +69,37 @@ int main() {
 	// SFML event.
 	sf::Event ev;
 
+	// Handles a single SFML event.
+	auto handleEvent = [&window, &statemachine, &input](const sf::Event& ev) {
+		if (ev.type == sf::Event::Closed) {
+			statemachine.close();
+		}
+		else if (ev.type == sf::Event::Resized || ev.type == sf::Event::GainedFocus) {
+			statemachine.requestRedraw();
+		}
+
+		if (ev.type == sf::Event::GainedFocus || ev.type == sf::Event::LostFocus) {
+			input.setFocused(ev.type == sf::Event::GainedFocus);
+		}
+
+		game.decodeSFMLEvent(ev);
+	};
+
 	while (window.isOpen()) {
+		if (!statemachine.needsRedraw()) {
+			// Nothing on screen changed, sleep until input arrives instead of drawing the same frame again.
+			if (statemachine.waitEvent(ev)) {
+				handleEvent(ev);
+			}
+
+			clock.restart();
+			continue;
+		}
+
 		float elapsedTime = clock.getElapsedTime().asSeconds();
 
 		while (window.pollEvent(ev)) {
-			if (ev.type == sf::Event::Closed) {
-				window.close();
-			}
-
-			game.decodeSFMLEvent(ev);
+			handleEvent(ev);
 		}
 
 		if (elapsedTime >= 1.0f / FPS) {